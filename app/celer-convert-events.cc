@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celer-convert-events.cc
+//---------------------------------------------------------------------------//
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "corecel/io/Logger.hh"
+#include "corecel/io/StringUtils.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/ScopedMpiInit.hh"
+#include "celeritas/ext/RootImporter.hh"
+#include "celeritas/ext/ScopedRootErrorHandler.hh"
+#include "celeritas/io/EventReader.hh"
+#include "celeritas/io/ImportData.hh"
+#include "celeritas/io/MappedEventWriter.hh"
+#include "celeritas/io/RootEventReader.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+namespace celeritas
+{
+namespace app
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Copy all events from a reader to the mapped primary writer.
+ */
+size_type convert(EventReaderInterface& read_event,
+                  EventWriterInterface& write_event)
+{
+    size_type num_events = 0;
+    for (auto event = read_event(); !event.empty(); event = read_event())
+    {
+        write_event(event);
+        ++num_events;
+    }
+    return num_events;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a HepMC3 or ROOT event file to a mapped primary file.
+ */
+void run(std::string const& physics_file,
+         std::string const& inp_file,
+         std::string const& out_file)
+{
+    ImportData data;
+    {
+        ScopedRootErrorHandler scoped_root_error;
+        RootImporter import(physics_file);
+        data = import();
+        scoped_root_error.throw_if_errors();
+    }
+    std::shared_ptr<ParticleParams const> particles
+        = ParticleParams::from_import(data);
+
+    MappedEventWriter write_event(out_file, particles);
+    size_type num_events = 0;
+    if (ends_with(inp_file, ".root"))
+    {
+        RootEventReader read_event(inp_file, particles);
+        num_events = convert(read_event, write_event);
+    }
+    else
+    {
+        // Assume filename is one of the HepMC3-supported extensions
+        EventReader read_event(inp_file, particles);
+        num_events = convert(read_event, write_event);
+    }
+    CELER_LOG(info) << "Converted " << num_events << " events";
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+}  // namespace app
+}  // namespace celeritas
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    using namespace celeritas;
+
+    ScopedMpiInit scoped_mpi(&argc, &argv);
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
+        && MpiCommunicator::comm_world().size() > 1)
+    {
+        CELER_LOG(critical) << "This app cannot run in parallel";
+        return EXIT_FAILURE;
+    }
+
+    if (argc != 4)
+    {
+        // If number of arguments is incorrect, print help
+        std::cerr << "usage: " << argv[0]
+                  << " {physics}.root {input}.{hepmc3,root} {output}.celprim"
+                  << std::endl;
+        return 2;
+    }
+
+    try
+    {
+        app::run(argv[1], argv[2], argv[3]);
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(critical) << "While converting events from " << argv[2]
+                            << ": " << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
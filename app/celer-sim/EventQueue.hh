@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celer-sim/EventQueue.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+namespace app
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Hand out event IDs to streams in order without locking.
+ *
+ * Since all events are read before transport starts, the queue is just an
+ * atomic counter: each stream claims the next untransported event when it
+ * becomes idle (or when its occupancy is low), so that a few large events
+ * don't leave the other streams idle at the end of the run.
+ */
+class EventQueue
+{
+  public:
+    // Construct with the total number of events
+    explicit inline EventQueue(size_type num_events);
+
+    // Claim the next event, returning a null ID if none remain
+    inline EventId pop();
+
+    //! Total number of events
+    size_type size() const { return size_; }
+
+  private:
+    size_type size_;
+    std::atomic<size_type> next_{0};
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the total number of events.
+ */
+EventQueue::EventQueue(size_type num_events) : size_{num_events} {}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Claim the next event, returning a null ID if none remain.
+ */
+EventId EventQueue::pop()
+{
+    // Don't increment past the end so that the counter can't wrap around
+    size_type result = next_.load(std::memory_order_relaxed);
+    do
+    {
+        if (result >= size_)
+        {
+            return {};
+        }
+    } while (!next_.compare_exchange_weak(
+        result, result + 1, std::memory_order_relaxed));
+    return EventId{result};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace app
+}  // namespace celeritas
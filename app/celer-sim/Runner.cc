@@ -7,8 +7,13 @@
 //---------------------------------------------------------------------------//
 #include "Runner.hh"
 
+#include <cstddef>
+#include <fstream>
 #include <functional>
+#include <iomanip>
 #include <memory>
+#include <sstream>
+#include <tuple>
 #include <random>
 #include <type_traits>
 #include <utility>
@@ -18,11 +23,14 @@
 #    include <omp.h>
 #endif
 
+#include "corecel/Config.hh"
+
 #include "corecel/cont/Span.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/OutputRegistry.hh"
 #include "corecel/io/StringUtils.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/HashUtils.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/Environment.hh"
@@ -33,6 +41,7 @@
 #include "celeritas/em/params/UrbanMscParams.hh"
 #include "celeritas/em/params/WentzelOKVIParams.hh"
 #include "celeritas/ext/GeantImporter.hh"
+#include "celeritas/ext/GeantPhysicsOptionsIO.json.hh"
 #include "celeritas/ext/GeantSetup.hh"
 #include "celeritas/ext/RootFileManager.hh"
 #include "celeritas/ext/RootImporter.hh"
@@ -45,6 +54,7 @@
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/io/EventReader.hh"
+#include "celeritas/io/MappedEventReader.hh"
 #include "celeritas/io/RootEventReader.hh"
 #include "celeritas/mat/MaterialParams.hh"
 #include "celeritas/optical/CerenkovParams.hh"
@@ -67,6 +77,7 @@
 #include "celeritas/user/RootStepWriter.hh"
 #include "celeritas/user/SimpleCalo.hh"
 #include "celeritas/user/StepCollector.hh"
+#include "celeritas/user/StepColumnWriter.hh"
 #include "celeritas/user/StepData.hh"
 #include "celeritas/user/StepDiagnostic.hh"
 
@@ -112,6 +123,64 @@ size_type calc_num_streams(RunnerInput const& inp, size_type num_events)
     return std::min(num_threads, num_events);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the path to the physics table cache for the given input.
+ *
+ * The cache key is a hash of:
+ * - the physics input file's contents (or the GDML file if the physics is
+ *   built from Geant4),
+ * - the Geant4 version and the locations of its physics data sets (whose
+ *   directory names include the data versions), and
+ * - the options that affect the physics processes.
+ */
+std::pair<std::string, std::size_t>
+physics_cache(RunnerInput const& inp)
+{
+    if (inp.physics_cache_dir.empty())
+    {
+        return {};
+    }
+
+    std::string const& filename
+        = !inp.physics_file.empty() ? inp.physics_file : inp.geometry_file;
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile, << "failed to open '" << filename << "'");
+
+    // Hash the file contents a block at a time
+    std::size_t file_hash{};
+    {
+        Hasher hash{&file_hash};
+        std::vector<char> buffer(1 << 16);
+        while (infile.read(buffer.data(), buffer.size()) || infile.gcount())
+        {
+            hash(Span<std::byte const>{
+                reinterpret_cast<std::byte const*>(buffer.data()),
+                static_cast<std::size_t>(infile.gcount())});
+        }
+    }
+
+    std::string data_dirs;
+    for (char const* var : {"G4LEDATA", "G4ENSDFSTATEDATA", "G4PARTICLEXSDATA"})
+    {
+        data_dirs += celeritas::getenv(var);
+        data_dirs += '\n';
+    }
+
+    std::size_t key = hash_combine(
+        file_hash,
+        std::string_view{celeritas_geant4_version},
+        data_dirs,
+        nlohmann::json(inp.physics_options).dump(),
+        inp.brem_combined,
+        inp.brem_sb_cdf);
+
+    std::ostringstream os;
+    os << inp.physics_cache_dir << "/physics-" << std::hex
+       << std::setfill('0') << std::setw(2 * sizeof(key)) << key << ".bin";
+    return {os.str(), key};
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -166,6 +235,7 @@ Runner::Runner(RunnerInput const& inp, SPOutputRegistry output)
     }
 
     transporters_.resize(this->num_streams());
+    event_queue_ = std::make_unique<EventQueue>(this->num_events());
     CELER_ENSURE(core_params_);
 }
 
@@ -184,17 +254,41 @@ void Runner::warm_up()
 
 //---------------------------------------------------------------------------//
 /*!
- * Run on a single stream/thread, returning the transport result.
+ * Run events from the shared queue on a single stream/thread.
  *
- * This will partition the input primaries among all the streams.
+ * Each stream claims the next untransported event whenever it finishes one,
+ * so that the load is balanced across streams even when event sizes vary
+ * widely. The result for each event is stored at its index. When events are
+ * overlapped by refilling, their steps can't be attributed to a single event,
+ * so the result from the combined transport loop is stored at the index of
+ * the first event and lists all the events merged into it. The results for
+ * the events that were added to it are left empty.
  */
-auto Runner::operator()(StreamId stream, EventId event) -> RunnerResult
+void Runner::operator()(StreamId stream, SpanResult results)
 {
     CELER_EXPECT(stream < this->num_streams());
-    CELER_EXPECT(event < this->num_events());
+    CELER_EXPECT(results.size() == this->num_events());
+    CELER_EXPECT(event_queue_);
 
     auto& transport = this->get_transporter(stream);
-    return transport(make_span(events_[event.get()]));
+    std::vector<size_type> merged;
+    auto next_primaries = [this, &merged]() -> SpanConstPrimary {
+        if (EventId event = event_queue_->pop())
+        {
+            merged.push_back(event.get());
+            return this->get_primaries(event);
+        }
+        return {};
+    };
+
+    for (EventId event = event_queue_->pop(); event;
+         event = event_queue_->pop())
+    {
+        merged = {event.get()};
+        auto& result = results[event.get()];
+        result = transport(this->get_primaries(event), next_primaries);
+        result.events = std::move(merged);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -207,7 +301,9 @@ auto Runner::operator()() -> RunnerResult
     CELER_EXPECT(this->num_streams() == 1);
 
     auto& transport = this->get_transporter(StreamId{0});
-    return transport(make_span(events_.front()));
+    auto result = transport(make_span(events_.front()));
+    result.events = {0};
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -226,6 +322,10 @@ StreamId::size_type Runner::num_streams() const
  */
 size_type Runner::num_events() const
 {
+    if (mapped_events_)
+    {
+        return mapped_events_->num_events();
+    }
     return events_.size();
 }
 
@@ -299,8 +399,9 @@ void Runner::build_core_params(RunnerInput const& inp,
     {
         CELER_LOG(warning) << "Geometry contains surfaces that are "
                               "incompatible with the current ORANGE simple "
-                              "safety algorithm: multiple scattering may "
-                              "result in arbitrarily small steps";
+                              "safety algorithm: conservative safety "
+                              "distances may result in shorter multiple "
+                              "scattering steps";
     }
 
     // Load materials
@@ -326,9 +427,13 @@ void Runner::build_core_params(RunnerInput const& inp,
         input.particles = params.particle;
         input.materials = params.material;
         input.action_registry = params.action_reg.get();
+        std::tie(input.cache_file, input.cache_key) = physics_cache(inp);
 
         input.options.fixed_step_limiter = inp.step_limiter;
         input.options.secondary_stack_factor = inp.secondary_stack_factor;
+        input.options.xs_majorant_bins_per_decade
+            = inp.xs_majorant_bins_per_decade;
+        input.options.compact_tables = inp.compact_physics_tables;
         input.options.linear_loss_limit = imported.em_params.linear_loss_limit;
         input.options.lowest_electron_energy = PhysicsParamsOptions::Energy(
             imported.em_params.lowest_electron_energy);
@@ -337,6 +442,7 @@ void Runner::build_core_params(RunnerInput const& inp,
             std::vector<std::shared_ptr<Process const>> result;
             ProcessBuilder::Options opts;
             opts.brem_combined = inp.brem_combined;
+            opts.brem_sb_cdf = inp.brem_sb_cdf;
             opts.brems_selection = inp.physics_options.brems;
 
             ProcessBuilder build_process(
@@ -432,11 +538,18 @@ void Runner::build_transporter_input(RunnerInput const& inp)
                    << "nonpositive num_track_slots=" << inp.num_track_slots);
     CELER_VALIDATE(inp.max_steps > 0,
                    << "nonpositive max_steps=" << inp.max_steps);
+    CELER_VALIDATE(inp.event_refill_fraction >= 0
+                       && inp.event_refill_fraction <= 1,
+                   << "invalid event_refill_fraction="
+                   << inp.event_refill_fraction
+                   << " (must be in [0, 1])");
 
     transporter_input_ = std::make_shared<TransporterInput>();
     transporter_input_->num_track_slots
         = ceil_div(inp.num_track_slots, core_params_->max_streams());
     transporter_input_->max_steps = inp.max_steps;
+    transporter_input_->refill_threshold = static_cast<size_type>(
+        inp.event_refill_fraction * transporter_input_->num_track_slots);
     transporter_input_->store_track_counts = inp.write_track_counts;
     transporter_input_->store_step_times = inp.write_step_times;
     transporter_input_->action_times = inp.action_times;
@@ -447,6 +560,10 @@ void Runner::build_transporter_input(RunnerInput const& inp)
 /*!
  * Read events from a file or build using a primary generator.
  *
+ * Events in a mapped primary file (see \c MappedEventWriter ) are not read
+ * here unless they are being merged: each stream accesses them directly from
+ * the file mapping as it transports them.
+ *
  * This returns the total number of events.
  */
 size_type
@@ -483,6 +600,19 @@ Runner::build_events(RunnerInput const& inp, SPConstParticles particles)
         return read_events(
             PrimaryGenerator::from_options(particles, inp.primary_options));
     }
+    else if (ends_with(inp.event_file, ".celprim"))
+    {
+        if (inp.merge_events)
+        {
+            return read_events(MappedEventReader(inp.event_file, particles));
+        }
+
+        // Leave events in the file mapping, to be loaded lazily as they are
+        // transported
+        mapped_events_
+            = std::make_shared<MappedEventReader>(inp.event_file, particles);
+        return mapped_events_->num_events();
+    }
     else if (ends_with(inp.event_file, ".root"))
     {
         if (inp.file_sampling_options)
@@ -508,6 +638,20 @@ Runner::build_events(RunnerInput const& inp, SPConstParticles particles)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the primaries for a single event.
+ */
+auto Runner::get_primaries(EventId event) const -> SpanConstPrimary
+{
+    if (mapped_events_)
+    {
+        return (*mapped_events_)(event);
+    }
+    CELER_ASSERT(event < events_.size());
+    return make_span(events_[event.get()]);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct on all threads from a JSON input and shared output manager.
@@ -529,6 +673,13 @@ void Runner::build_step_collectors(RunnerInput const& inp)
             make_write_filter(inp.mctruth_filter)));
     }
 
+    if (!inp.step_column_file.empty())
+    {
+        // Write all step data as binary columns from every stream
+        step_interfaces.push_back(std::make_shared<StepColumnWriter>(
+            inp.step_column_file, StepSelection::all()));
+    }
+
     if (!inp.simple_calo.empty())
     {
         auto simple_calo
@@ -13,10 +13,12 @@
 #include <vector>
 
 #include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/phys/Primary.hh"
 
+#include "EventQueue.hh"
 #include "Transporter.hh"
 
 class G4VPhysicalVolume;  // IWYU pragma: keep
@@ -24,6 +26,7 @@ class G4VPhysicalVolume;  // IWYU pragma: keep
 namespace celeritas
 {
 class CoreParams;
+class MappedEventReader;
 class OpticalCollector;
 class OutputRegistry;
 class ParticleParams;
@@ -40,7 +43,9 @@ struct RunnerInput;
  * Manage execution of Celeritas.
  *
  * This class is meant to be created in a single-thread context, and executed
- * in a multi-thread context.
+ * in a multi-thread context. Streams claim events from a shared queue as they
+ * finish their previous ones, and if \c event_refill_fraction is set they
+ * start the next event when the number of active tracks drops.
  */
 class Runner
 {
@@ -50,6 +55,7 @@ class Runner
     using Input = RunnerInput;
     using MapStrDouble = std::unordered_map<std::string, double>;
     using RunnerResult = TransporterResult;
+    using SpanResult = Span<RunnerResult>;
     using SPOutputRegistry = std::shared_ptr<OutputRegistry>;
     //!@}
 
@@ -60,8 +66,8 @@ class Runner
     // Warm up by running a single step with no active tracks
     void warm_up();
 
-    // Run on a single stream/thread, returning the transport result
-    RunnerResult operator()(StreamId, EventId);
+    // Run events from the shared queue on a single stream/thread
+    void operator()(StreamId, SpanResult results);
 
     // Run all events simultaneously on a single stream
     RunnerResult operator()();
@@ -82,6 +88,7 @@ class Runner
     using SPConstParticles = std::shared_ptr<ParticleParams const>;
     using VecPrimary = std::vector<Primary>;
     using VecEvent = std::vector<VecPrimary>;
+    using SpanConstPrimary = TransporterBase::SpanConstPrimary;
 
     //// DATA ////
 
@@ -94,6 +101,8 @@ class Runner
     bool use_device_{};
     std::shared_ptr<TransporterInput> transporter_input_;
     VecEvent events_;
+    std::shared_ptr<MappedEventReader const> mapped_events_;
+    std::unique_ptr<EventQueue> event_queue_;
     std::vector<UPTransporterBase> transporters_;
 
     //// HELPER FUNCTIONS ////
@@ -108,6 +117,7 @@ class Runner
     void build_diagnostics(RunnerInput const&);
     void build_transporter_input(RunnerInput const&);
     size_type build_events(RunnerInput const&, SPConstParticles);
+    SpanConstPrimary get_primaries(EventId) const;
     TransporterBase& get_transporter(StreamId);
     TransporterBase const* get_transporter_ptr(StreamId) const;
 };
@@ -75,6 +75,7 @@ struct RunnerInput
     // Problem definition
     std::string geometry_file;  //!< Path to GDML file
     std::string physics_file;  //!< Path to ROOT exported Geant4 data
+    std::string physics_cache_dir;  //!< Directory for cached physics tables
     std::string event_file;  //!< Path to input event data
 
     // Optional setup when event_file is a ROOT input used for sampling
@@ -86,6 +87,7 @@ struct RunnerInput
 
     // Diagnostics and output
     std::string mctruth_file;  //!< Path to ROOT MC truth event data
+    std::string step_column_file;  //!< Path to binary column step data
     std::string tracing_file;
     SimpleRootFilterInput mctruth_filter;
     std::vector<Label> simple_calo;
@@ -98,12 +100,16 @@ struct RunnerInput
     // Control
     unsigned int seed{};
     size_type num_track_slots{};  //!< Divided among streams
-    size_type max_steps = static_cast<size_type>(-1);
+    size_type max_steps = static_cast<size_type>(-1);  //!< Per event
     size_type initializer_capacity{};  //!< Divided among streams
     real_type secondary_stack_factor{};
     bool use_device{};
     bool action_times{};
     bool merge_events{false};  //!< Run all events at once on a single stream
+    real_type event_refill_fraction{0};  //!< Start the next event when the
+                                         //!< fraction of active tracks
+                                         //!< drops below this (results of
+                                         //!< overlapped events are merged)
     bool default_stream{false};  //!< Launch all kernels on the default stream
     bool warm_up{CELER_USE_DEVICE};  //!< Run a nullop step first
 
@@ -117,6 +123,9 @@ struct RunnerInput
 
     // Options for physics
     bool brem_combined{false};
+    bool brem_sb_cdf{false};
+    size_type xs_majorant_bins_per_decade{0};  //!< Zero to disable
+    bool compact_physics_tables{false};  //!< Single-precision xs tables
 
     // Track init options
     TrackOrder track_order{TrackOrder::unsorted};
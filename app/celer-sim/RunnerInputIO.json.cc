@@ -76,6 +76,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
         LDIO_LOAD_REQUIRED(geometry_file);
     }
     LDIO_LOAD_OPTION(physics_file);
+    LDIO_LOAD_OPTION(physics_cache_dir);
     LDIO_LOAD_OPTION(event_file);
 
     LDIO_LOAD_OPTION(file_sampling_options);
@@ -88,6 +89,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_DEPRECATED(step_diagnostic_maxsteps, step_diagnostic_bins);
 
     LDIO_LOAD_OPTION(mctruth_file);
+    LDIO_LOAD_OPTION(step_column_file);
     LDIO_LOAD_OPTION(tracing_file);
     LDIO_LOAD_OPTION(mctruth_filter);
     LDIO_LOAD_OPTION(simple_calo);
@@ -108,6 +110,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_REQUIRED(use_device);
     LDIO_LOAD_OPTION(action_times);
     LDIO_LOAD_OPTION(merge_events);
+    LDIO_LOAD_OPTION(event_refill_fraction);
     LDIO_LOAD_OPTION(default_stream);
     LDIO_LOAD_OPTION(warm_up);
 
@@ -120,6 +123,9 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
 
     LDIO_LOAD_OPTION(step_limiter);
     LDIO_LOAD_OPTION(brem_combined);
+    LDIO_LOAD_OPTION(brem_sb_cdf);
+    LDIO_LOAD_OPTION(xs_majorant_bins_per_decade);
+    LDIO_LOAD_OPTION(compact_physics_tables);
     LDIO_LOAD_OPTION(track_order);
     LDIO_LOAD_OPTION(physics_options);
 
@@ -164,6 +170,7 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
 
     LDIO_SAVE(geometry_file);
     LDIO_SAVE(physics_file);
+    LDIO_SAVE_OPTION(physics_cache_dir);
     LDIO_SAVE_OPTION(event_file);
     LDIO_SAVE_WHEN(file_sampling_options,
                    ends_with(v.event_file, ".root")
@@ -171,6 +178,7 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE_WHEN(primary_options, v.event_file.empty());
 
     LDIO_SAVE_OPTION(mctruth_file);
+    LDIO_SAVE_OPTION(step_column_file);
     LDIO_SAVE_WHEN(tracing_file, CELERITAS_USE_PERFETTO);
     LDIO_SAVE_WHEN(mctruth_filter, !v.mctruth_file.empty());
     LDIO_SAVE(simple_calo);
@@ -188,6 +196,7 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE(use_device);
     LDIO_SAVE(action_times);
     LDIO_SAVE(merge_events);
+    LDIO_SAVE_OPTION(event_refill_fraction);
     LDIO_SAVE(default_stream);
     LDIO_SAVE(warm_up);
 
@@ -196,6 +205,9 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
 
     LDIO_SAVE_OPTION(step_limiter);
     LDIO_SAVE(brem_combined);
+    LDIO_SAVE_OPTION(brem_sb_cdf);
+    LDIO_SAVE_OPTION(xs_majorant_bins_per_decade);
+    LDIO_SAVE_OPTION(compact_physics_tables);
 
     LDIO_SAVE(track_order);
     LDIO_SAVE_WHEN(physics_options,
@@ -50,6 +50,7 @@ void RunnerOutput::output(JsonPimpl* j) const
     auto num_aborted = json::array();
     auto max_queued = json::array();
     auto step_times = json::array();
+    auto events = json::array();
 
     for (auto const& event : result_.events)
     {
@@ -66,6 +67,7 @@ void RunnerOutput::output(JsonPimpl* j) const
         num_steps.push_back(event.num_steps);
         num_aborted.push_back(event.num_aborted);
         max_queued.push_back(event.max_queued);
+        events.push_back(event.events);
         if (!event.step_times.empty())
         {
             step_times.push_back(event.step_times);
@@ -107,6 +109,7 @@ void RunnerOutput::output(JsonPimpl* j) const
          {"num_steps", std::move(num_steps)},
          {"num_aborted", std::move(num_aborted)},
          {"max_queued", std::move(max_queued)},
+         {"events", std::move(events)},
          {"num_streams", result_.num_streams},
          {"time", std::move(times)}});
 
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <csignal>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <utility>
@@ -45,6 +46,7 @@ TransporterBase::~TransporterBase() = default;
 template<MemSpace M>
 Transporter<M>::Transporter(TransporterInput inp)
     : max_steps_(inp.max_steps)
+    , refill_threshold_(inp.refill_threshold)
     , num_streams_(inp.params->max_streams())
     , store_track_counts_(inp.store_track_counts)
     , store_step_times_(inp.store_step_times)
@@ -82,6 +84,25 @@ void Transporter<M>::operator()()
  */
 template<MemSpace M>
 auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
+{
+    return (*this)(primaries, NextPrimaries{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport primaries, adding more events as the occupancy drops.
+ *
+ * When the number of alive and queued tracks falls below the refill
+ * threshold, the primaries for another event are requested and added to the
+ * state so that the tail of one event overlaps with the start of the next.
+ * The function returns an empty span when no events remain, after which it is
+ * not called again. The step limit applies per event: each added event
+ * extends the number of remaining step iterations by \c max_steps. The
+ * tallied result is merged over all events transported by this call.
+ */
+template<MemSpace M>
+auto Transporter<M>::operator()(SpanConstPrimary primaries,
+                                NextPrimaries const& next) -> TransporterResult
 {
     // Initialize results
     TransporterResult result;
@@ -133,6 +154,7 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
     StepTimer record_step_time{store_step_times_ ? &result.step_times
                                                  : nullptr};
     size_type remaining_steps = max_steps_;
+    constexpr auto max_size = std::numeric_limits<size_type>::max();
 
     auto& step = *stepper_;
     // Copy primaries to device and transport the first step
@@ -140,12 +162,18 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
     append_track_counts(track_counts);
     record_step_time();
 
-    while (track_counts)
+    bool exhausted = !next;
+    auto should_refill = [&] {
+        return !exhausted
+               && track_counts.alive + track_counts.queued < refill_threshold_;
+    };
+
+    while (track_counts || should_refill())
     {
         if (CELER_UNLIKELY(--remaining_steps == 0))
         {
             CELER_LOG_LOCAL(error) << "Exceeded step count of " << max_steps_
-                                   << ": aborting transport loop";
+                                   << " per event: aborting transport loop";
             break;
         }
         if (CELER_UNLIKELY(interrupted()))
@@ -156,7 +184,30 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
             break;
         }
 
-        track_counts = step();
+        primaries = {};
+        if (should_refill())
+        {
+            primaries = next();
+            exhausted = primaries.empty();
+        }
+        if (!primaries.empty())
+        {
+            CELER_LOG_LOCAL(debug)
+                << "Adding " << primaries.size() << " primaries";
+            // Give the new event its own step budget
+            remaining_steps
+                += std::min(max_steps_, max_size - remaining_steps);
+            track_counts = step(primaries);
+        }
+        else if (track_counts)
+        {
+            track_counts = step();
+        }
+        else
+        {
+            // No events remain
+            break;
+        }
         append_track_counts(track_counts);
         record_step_time();
     }
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -42,7 +43,9 @@ struct TransporterInput
                                //!< actions for timing
 
     // Loop control
-    size_type max_steps{};
+    size_type max_steps{};  //!< Step iterations allowed per event
+    size_type refill_threshold{};  //!< Add the next event when fewer tracks
+                                   //!< than this remain (zero to disable)
     bool store_track_counts{};  //!< Store track counts at each step
     bool store_step_times{};  //!< Store time elapsed for each step
 
@@ -71,6 +74,7 @@ struct TransporterResult
     std::vector<double> step_times;  //!< Real time per step
 
     // Always-on basic diagnostics
+    std::vector<size_type> events;  //!< Input events merged into this result
     size_type num_track_slots{};  //!< Number of total track slots
     size_type num_step_iterations{};  //!< Total number of step iterations
     size_type num_steps{};  //!< Total number of steps
@@ -98,6 +102,7 @@ class TransporterBase
     //!@{
     //! \name Type aliases
     using SpanConstPrimary = Span<Primary const>;
+    using NextPrimaries = std::function<SpanConstPrimary()>;
     using MapStrDouble = std::unordered_map<std::string, double>;
     //!@}
 
@@ -110,6 +115,11 @@ class TransporterBase
     //! Transport the input primaries and all secondaries produced
     virtual TransporterResult operator()(SpanConstPrimary primaries) = 0;
 
+    //! Transport primaries, adding more events as the occupancy drops
+    virtual TransporterResult
+    operator()(SpanConstPrimary primaries, NextPrimaries const& next)
+        = 0;
+
     //! Accumulate action times into the map
     virtual void accum_action_times(MapStrDouble*) const = 0;
 };
@@ -131,12 +141,17 @@ class Transporter final : public TransporterBase
     // Transport the input primaries and all secondaries produced
     TransporterResult operator()(SpanConstPrimary primaries) final;
 
+    // Transport primaries, adding more events as the occupancy drops
+    TransporterResult
+    operator()(SpanConstPrimary primaries, NextPrimaries const& next) final;
+
     // Accumulate action times into the map
     void accum_action_times(MapStrDouble*) const final;
 
   private:
     std::shared_ptr<Stepper<M>> stepper_;
     size_type max_steps_;
+    size_type refill_threshold_;
     size_type num_streams_;
     bool store_track_counts_;
     bool store_step_times_;
@@ -26,6 +26,7 @@
 #include "corecel/DeviceRuntimeApi.hh"
 #include "corecel/Version.hh"
 
+#include "corecel/cont/Span.hh"
 #include "corecel/io/BuildOutput.hh"
 #include "corecel/io/ExceptionOutput.hh"
 #include "corecel/io/Logger.hh"
@@ -124,15 +125,14 @@ void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
                           << " on " << num_streams << " threads";
         MultiExceptionHandler capture_exception;
 #if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
-#    pragma omp parallel for
+#    pragma omp parallel num_threads(num_streams)
 #endif
-        for (size_type event = 0; event < run_stream.num_events(); ++event)
         {
             activate_device_local();
 
-            // Run a single event on a single thread
-            CELER_TRY_HANDLE(result.events[event] = run_stream(
-                                 StreamId(get_openmp_thread()), EventId(event)),
+            // Run events from the shared queue on each thread
+            CELER_TRY_HANDLE(run_stream(StreamId(get_openmp_thread()),
+                                        make_span(result.events)),
                              capture_exception);
         }
         log_and_rethrow(std::move(capture_exception));
@@ -0,0 +1,55 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/BatchHitInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+struct DetectorStepOutput;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interface for sensitive detectors that accept hits in bulk.
+ *
+ * A \c G4VSensitiveDetector that also inherits from this class receives all
+ * hits in its volume from each batch of Celeritas steps in a single call,
+ * rather than one \c G4VSensitiveDetector::Hit call per step with a
+ * reconstructed \c G4Step. This avoids the cost of converting each step and
+ * (if \c SDSetupOptions::locate_touchable is enabled) of locating the
+ * touchable.
+ *
+ * The step data is in Celeritas native units, and only the quantities
+ * selected in \c SDSetupOptions are present. The indices are the steps in
+ * this detector, in the order they were produced.
+ */
+class BatchHitInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SpanConstIndex = Span<size_type const>;
+    //!@}
+
+  public:
+    virtual ~BatchHitInterface() = default;
+
+    // Process the given steps in this detector
+    virtual void ProcessHits(DetectorStepOutput const& steps,
+                             SpanConstIndex indices)
+        = 0;
+
+  protected:
+    BatchHitInterface() = default;
+    CELER_DEFAULT_COPY_MOVE(BatchHitInterface);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
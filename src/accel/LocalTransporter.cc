@@ -7,9 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "LocalTransporter.hh"
 
-#include <csignal>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <CLHEP/Units/SystemOfUnits.h>
 #include <G4MTRunManager.hh>
 #include <G4ParticleDefinition.hh>
@@ -23,11 +23,9 @@
 
 #include "corecel/Config.hh"
 
-#include "corecel/cont/Span.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/Environment.hh"
-#include "corecel/sys/ScopedSignalHandler.hh"
 #include "geocel/GeantUtils.hh"
 #include "geocel/g4/Convert.geant.hh"
 #include "celeritas/Quantities.hh"
@@ -41,26 +39,43 @@
 #include "SetupOptions.hh"
 #include "SharedParams.hh"
 
+#include "detail/BufferTransporter.hh"
 #include "detail/HitManager.hh"
+#include "detail/HitProcessor.hh"
 #include "detail/OffloadWriter.hh"
+#include "detail/TransportWorker.hh"
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+//! Construct in an invalid state
+LocalTransporter::LocalTransporter() = default;
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Default move and destroy (joining the background thread)
+LocalTransporter::LocalTransporter(LocalTransporter&&) = default;
+LocalTransporter& LocalTransporter::operator=(LocalTransporter&&) = default;
+LocalTransporter::~LocalTransporter() = default;
+//!@}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with shared (MT) params.
  */
 LocalTransporter::LocalTransporter(SetupOptions const& options,
                                    SharedParams& params)
-    : auto_flush_(options.auto_flush ? options.auto_flush
+    : async_flush_(options.async_flush)
+    , auto_flush_(options.auto_flush ? options.auto_flush
                                      : options.max_num_tracks)
-    , max_steps_(options.max_steps)
-    , dump_primaries_{params.offload_writer()}
 {
     CELER_VALIDATE(params,
                    << "Celeritas SharedParams was not initialized before "
                       "constructing LocalTransporter (perhaps the master "
                       "thread did not call BeginOfRunAction?");
+    CELER_VALIDATE(!(async_flush_ && options.auto_flush_steps),
+                   << "asynchronous flushing cannot be combined with a "
+                      "limited number of steps per flush");
     particles_ = params.Params()->particle();
 
     auto thread_id = get_geant_thread_id();
@@ -135,16 +150,62 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
 
     // Save state for reductions at the end
     params.set_state(stream_id.get(), step_->sp_state());
+
+    detail::BufferTransporter::Input transport_inp;
+    transport_inp.max_steps = options.max_steps;
+    transport_inp.buffer_size = auto_flush_;
+    transport_inp.flush_steps = options.auto_flush_steps;
+    transport_inp.init_capacity = params.Params()->init()->capacity();
+    transport_ = std::make_unique<detail::BufferTransporter>(
+        step_, transport_inp, params.offload_writer());
+
+    if (async_flush_)
+    {
+        int num_omp_threads{0};
+#ifdef _OPENMP
+        // Preserve the number of OpenMP threads assigned to this Geant4 thread
+        num_omp_threads = omp_get_max_threads();
+#endif
+        worker_ = std::make_unique<detail::TransportWorker>(
+            [num_omp_threads] {
+                activate_device_local();
+#ifdef _OPENMP
+                omp_set_num_threads(num_omp_threads);
+#else
+                CELER_DISCARD(num_omp_threads);
+#endif
+            },
+            max_deferred_hits);
+        in_flight_ = std::make_shared<VecPrimary>();
+
+        if (hit_processor_)
+        {
+            // Sensitive detectors can't be called from the transport thread
+            hit_processor_->defer_hits(
+                [worker = worker_.get()](detail::HitProcessor::Task task) {
+                    worker->call_owner(std::move(task));
+                });
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Set the event ID and reseed the Celeritas RNG at the start of an event.
+ *
+ * In asynchronous mode this first waits for the background thread, which
+ * should be idle since the previous event was flushed, so that the transport
+ * state is never modified while the thread can use it.
  */
 void LocalTransporter::InitializeEvent(int id)
 {
     CELER_EXPECT(*this);
     CELER_EXPECT(id >= 0);
+    if (worker_)
+    {
+        worker_->wait();
+    }
+    CELER_EXPECT(!transport_->tracks_active());
 
     event_id_ = EventId(id);
     track_counter_ = 0;
@@ -201,68 +262,107 @@ void LocalTransporter::Push(G4Track const& g4track)
     track.track_id = TrackId{track_counter_++};
     track.event_id = event_id_;
 
+    if (worker_)
+    {
+        // Send hits from tracks transported so far to Geant4
+        worker_->poll();
+    }
+
     buffer_.push_back(track);
     if (buffer_.size() >= auto_flush_)
     {
-        /*!
-         * \todo Maybe only run one iteration? But then make sure that Flush
-         * still transports active tracks to completion.
-         */
-        this->Flush();
+        if (async_flush_)
+        {
+            this->launch_transport();
+        }
+        else if (transport_->partial())
+        {
+            this->partial_flush();
+        }
+        else
+        {
+            this->Flush();
+        }
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Transport the buffered tracks and all secondaries produced.
+ *
+ * In asynchronous mode this first waits for any tracks being transported on
+ * the other thread (sending their hits to the sensitive detectors), then
+ * transports the remaining buffer on this thread.
+ * Tracks still active from a partial flush are also transported to
+ * completion.
  */
 void LocalTransporter::Flush()
 {
     CELER_EXPECT(*this);
-    if (buffer_.empty())
+    if (worker_)
     {
-        return;
+        worker_->wait();
     }
-    if (celeritas::device())
+    if (!buffer_.empty() || transport_->tracks_active())
     {
-        CELER_LOG_LOCAL(info)
-            << "Transporting " << buffer_.size() << " tracks from event "
-            << event_id_.unchecked_get() << " with Celeritas";
+        if (celeritas::device())
+        {
+            CELER_LOG_LOCAL(info)
+                << "Transporting " << buffer_.size() << " tracks from event "
+                << event_id_.unchecked_get() << " with Celeritas";
+        }
+        transport_->flush(&buffer_);
     }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the buffered tracks and run a limited number of step iterations.
+ *
+ * Tracks that are still active afterward stay in the Celeritas state and are
+ * transported along with the next buffer of tracks.
+ */
+void LocalTransporter::partial_flush()
+{
+    CELER_EXPECT(!buffer_.empty());
 
-    if (dump_primaries_)
+    if (celeritas::device())
     {
-        // Write offload particles if user requested
-        (*dump_primaries_)(buffer_);
+        CELER_LOG_LOCAL(debug)
+            << "Transporting " << buffer_.size() << " tracks from event "
+            << event_id_.unchecked_get() << " for a limited number of steps";
     }
+    transport_->partial_flush(&buffer_);
+}
 
-    /*!
-     * Abort cleanly for interrupt and user-defined (i.e., job manager)
-     * signals.
-     *
-     * \todo The signal handler is \em not thread safe. We may need to set an
-     * atomic/volatile bit so all local transporters abort.
-     */
-    ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
-
-    // Copy buffered tracks to device and transport the first step
-    auto track_counts = (*step_)(make_span(buffer_));
-    buffer_.clear();
+//---------------------------------------------------------------------------//
+/*!
+ * Transport the full buffer on the background thread.
+ *
+ * The previously launched transport must complete before the stepper can be
+ * reused, so at most one buffer is in flight while the other is filled. The
+ * in-flight buffer is emptied by the transport so that its capacity is reused
+ * by the next swap.
+ */
+void LocalTransporter::launch_transport()
+{
+    CELER_EXPECT(worker_ && in_flight_);
 
-    size_type step_iters = 1;
+    worker_->wait();
+    CELER_ASSERT(in_flight_->empty());
+    std::swap(buffer_, *in_flight_);
 
-    while (track_counts)
+    if (celeritas::device())
     {
-        CELER_VALIDATE(step_iters < max_steps_,
-                       << "number of step iterations exceeded the allowed "
-                          "maximum ("
-                       << max_steps_ << ")");
-
-        track_counts = (*step_)();
-        ++step_iters;
-
-        CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
+        CELER_LOG_LOCAL(info)
+            << "Transporting " << in_flight_->size() << " tracks from event "
+            << event_id_.unchecked_get() << " with Celeritas asynchronously";
     }
+
+    // The transporter is only used by the owner after waiting
+    worker_->push([transport = transport_.get(), primaries = in_flight_] {
+        transport->flush(primaries.get());
+    });
 }
 
 //---------------------------------------------------------------------------//
@@ -275,9 +375,17 @@ void LocalTransporter::Flush()
 void LocalTransporter::Finalize()
 {
     CELER_EXPECT(*this);
-    CELER_VALIDATE(buffer_.empty(),
+    if (worker_)
+    {
+        worker_->wait();
+    }
+    CELER_VALIDATE(buffer_.empty() && !transport_->tracks_active(),
                    << "offloaded tracks (" << buffer_.size()
                    << " in buffer) were not flushed");
+    if (hit_processor_)
+    {
+        hit_processor_->defer_hits({});
+    }
 
     // Reset all data
     CELER_LOG_LOCAL(debug) << "Resetting local transporter";
@@ -26,8 +26,9 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 namespace detail
 {
+class BufferTransporter;
 class HitProcessor;
-class OffloadWriter;
+class TransportWorker;
 }  // namespace detail
 
 struct SetupOptions;
@@ -44,6 +45,20 @@ class SharedParams;
  *   of the event)
  * - a tracking action (to try offloading every track)
  *
+ * With the \c auto_flush_steps option, a full buffer is added to the
+ * Celeritas state and only stepped a limited number of times before
+ * returning to Geant4, so that the track slots stay occupied between
+ * buffers. The state is transported to completion when \c Flush is called at
+ * the end of the event.
+ *
+ * With the \c async_flush option, a full buffer is transported on a
+ * long-lived background CPU thread while \c Push continues to fill a second
+ * buffer. Since the Geant4 sensitive detectors can only be used from the
+ * worker thread, the hit processor copies each batch of hits and hands it
+ * back to this thread, which sends it to the detectors during the next call
+ * to \c Push or \c Flush . At most \c max_deferred_hits batches are pending:
+ * beyond that, the background thread waits for this one to catch up.
+ *
  * \warning Due to Geant4 thread-local allocators, this class \em must be
  * finalized or destroyed on the same CPU thread in which is created and used!
  *
@@ -57,13 +72,23 @@ class LocalTransporter
     using MapStrReal = std::unordered_map<std::string, real_type>;
     //!@}
 
+    //! Maximum number of hit batches waiting for the Geant4 thread
+    static constexpr size_type max_deferred_hits = 16;
+
   public:
     // Construct in an invalid state
-    LocalTransporter() = default;
+    LocalTransporter();
 
     // Initialized with shared (across threads) params
     LocalTransporter(SetupOptions const& options, SharedParams& params);
 
+    //!@{
+    //! Default move and destroy (joining the background thread)
+    LocalTransporter(LocalTransporter&&);
+    LocalTransporter& operator=(LocalTransporter&&);
+    ~LocalTransporter();
+    //!@}
+
     // Alternative to construction + move assignment
     inline void Initialize(SetupOptions const& options, SharedParams& params);
 
@@ -92,21 +117,33 @@ class LocalTransporter
     explicit operator bool() const { return static_cast<bool>(step_); }
 
   private:
-    using SPOffloadWriter = std::shared_ptr<detail::OffloadWriter>;
+    using VecPrimary = std::vector<Primary>;
 
     std::shared_ptr<ParticleParams const> particles_;
     std::shared_ptr<StepperInterface> step_;
-    std::vector<Primary> buffer_;
+    VecPrimary buffer_;
     std::shared_ptr<detail::HitProcessor> hit_processor_;
 
+    // Asynchronous transport of a second buffer
+    bool async_flush_{false};
+    std::shared_ptr<VecPrimary> in_flight_;
+
     EventId event_id_;
     TrackId::size_type track_counter_{};
 
     size_type auto_flush_{};
-    size_type max_steps_{};
 
-    // Shared across threads to write flushed particles
-    SPOffloadWriter dump_primaries_;
+    // Step buffered tracks, possibly leaving them in the state
+    std::unique_ptr<detail::BufferTransporter> transport_;
+
+    // Background thread: destroyed before the stepper and hit processor
+    std::unique_ptr<detail::TransportWorker> worker_;
+
+    // Add the buffered tracks and run a limited number of steps
+    void partial_flush();
+
+    // Transport the full buffer on the background thread
+    void launch_transport();
 };
 
 //---------------------------------------------------------------------------//
@@ -40,6 +40,14 @@ struct AlongStepFactoryInput;
  *   when the combination of options is enabled
  * - Track and Parent IDs will \em never be a valid value since Celeritas track
  *   counters are independent from Geant4 track counters.
+ * - Hits from each batch of Celeritas steps are sent to one sensitive
+ *   detector at a time, in the order of the detector volumes, rather than in
+ *   the order the steps were taken. Hits within a single detector keep their
+ *   step order. Code that relies on the order of hits \em across detectors
+ *   (e.g., a hit collection shared between detectors) should sort them by
+ *   time or track instead.
+ * - Detectors that also inherit from \c BatchHitInterface receive all their
+ *   hits from a batch in a single call.
  */
 struct SDSetupOptions
 {
@@ -128,8 +136,15 @@ struct SetupOptions
     real_type secondary_stack_factor{3.0};
     //! Number of tracks to buffer before offloading (if unset: max num tracks)
     size_type auto_flush{};
+    //! Step iterations per auto-flush (if unset: transport to completion)
+    size_type auto_flush_steps{};
+    //! Transport full buffers on a separate thread while Geant4 continues
+    bool async_flush{false};
     //!@}
 
+    //! Share host params data among the MPI processes on each node
+    bool share_params{false};
+
     //! Set the number of streams (defaults to run manager # threads)
     IntAccessor get_num_streams;
 
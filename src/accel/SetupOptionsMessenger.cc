@@ -193,6 +193,15 @@ SetupOptionsMessenger::SetupOptionsMessenger(SetupOptions* options)
     add_cmd(&options->auto_flush,
             "autoFlush",
             "Number of tracks to buffer before offloading");
+    add_cmd(&options->auto_flush_steps,
+            "autoFlushSteps",
+            "Number of step iterations per auto-flush");
+    add_cmd(&options->async_flush,
+            "asyncFlush",
+            "Transport full buffers on a separate thread");
+    add_cmd(&options->share_params,
+            "shareParams",
+            "Share params data among MPI processes on each node");
     add_cmd(&options->max_field_substeps,
             "maxFieldSubsteps",
             "Limit on substeps in the field propagator");
@@ -34,6 +34,9 @@ struct SetupOptions;
   maxInitializers      | Maximum number of track initializers
   secondaryStackFactor | At least the average number of secondaries per track
   autoFlush            | Number of tracks to buffer before offloading
+  autoFlushSteps       | Number of step iterations per auto-flush
+  asyncFlush           | Transport full buffers on a separate thread
+  shareParams          | Share params data among MPI processes on each node
   maxFieldSubsteps     | Limit on substeps in field propagator
 
  * The following option is exposed in the \c /celer/detector/ command
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -25,6 +26,7 @@
 #include "corecel/Config.hh"
 
 #include "corecel/Assert.hh"
+#include "corecel/data/ScopedSharedParams.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/OutputRegistry.hh"
 #include "corecel/io/ScopedTimeLog.hh"
@@ -33,6 +35,7 @@
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/Environment.hh"
 #include "corecel/sys/KernelRegistry.hh"
+#include "corecel/sys/MpiCommunicator.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "corecel/sys/ThreadId.hh"
@@ -267,8 +270,8 @@ SharedParams::SharedParams(SetupOptions const& options)
             writer.reset(new EventWriter(options.offload_output_file,
                                          params_->particle()));
         }
-        offload_writer_
-            = std::make_shared<detail::OffloadWriter>(std::move(writer));
+        offload_writer_ = std::make_shared<detail::OffloadWriter>(
+            std::move(writer), params_->max_streams());
     }
 
     CELER_ENSURE(*this);
@@ -328,6 +331,7 @@ void SharedParams::Finalize()
 
     // Reset all data
     CELER_LOG_LOCAL(debug) << "Resetting shared parameters";
+    auto offload_writer = std::move(offload_writer_);
     *this = {};
 
     if (auto& d = celeritas::device())
@@ -336,6 +340,12 @@ void SharedParams::Finalize()
         d.create_streams(0);
     }
 
+    if (offload_writer)
+    {
+        // Write remaining offloaded primaries and report any write error
+        offload_writer->finalize();
+    }
+
     CELER_ENSURE(!*this);
 }
 
@@ -453,6 +463,13 @@ void SharedParams::initialize_core(SetupOptions const& options)
         export_root(*imported);
     }
 
+    // Place large host data in memory shared by the processes on each node
+    std::optional<ScopedSharedParams> share_params;
+    if (options.share_params)
+    {
+        share_params.emplace(MpiCommunicator::comm_default());
+    }
+
     CoreParams::Input params;
 
     // Create registries
@@ -0,0 +1,135 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/BufferTransporter.cc
+//---------------------------------------------------------------------------//
+#include "BufferTransporter.hh"
+
+#include <csignal>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/sys/ScopedSignalHandler.hh"
+#include "celeritas/global/Stepper.hh"
+
+#include "OffloadWriter.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with stepper and optional offload writer.
+ */
+BufferTransporter::BufferTransporter(SPStepper step,
+                                     Input const& inp,
+                                     SPOffloadWriter dump)
+    : step_{std::move(step)}, inp_{inp}, dump_{std::move(dump)}
+{
+    CELER_EXPECT(step_);
+    CELER_EXPECT(inp_.max_steps > 0);
+    CELER_EXPECT(!this->partial() || inp_.buffer_size > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport buffered and active tracks to completion.
+ */
+void BufferTransporter::flush(VecPrimary* primaries)
+{
+    CELER_EXPECT(primaries);
+    CELER_EXPECT(!primaries->empty() || tracks_active_);
+
+    this->transport(primaries, [](StepperResult const&) { return false; });
+    tracks_active_ = false;
+    step_iters_ = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add buffered tracks and run a limited number of step iterations.
+ *
+ * Tracks that are still active afterward stay in the state, keeping the track
+ * slots occupied until the next buffer is added.
+ */
+void BufferTransporter::partial_flush(VecPrimary* primaries)
+{
+    CELER_EXPECT(this->partial());
+    CELER_EXPECT(primaries && !primaries->empty());
+
+    size_type const max_iters = step_iters_ + inp_.flush_steps;
+    auto track_counts = this->transport(
+        primaries, [this, max_iters](StepperResult const& counts) {
+            return step_iters_ >= max_iters
+                   && counts.queued + inp_.buffer_size <= inp_.init_capacity;
+        });
+    tracks_active_ = static_cast<bool>(track_counts);
+    if (!tracks_active_)
+    {
+        step_iters_ = 0;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step the primaries and any active tracks until done or stopped.
+ *
+ * The stepping loop runs until no tracks remain or until \c stop_early
+ * returns true for the current track counts.
+ */
+template<class F>
+StepperResult
+BufferTransporter::transport(VecPrimary* primaries, F&& stop_early)
+{
+    /*!
+     * Abort cleanly for interrupt and user-defined (i.e., job manager)
+     * signals.
+     *
+     * \todo The signal handler is \em not thread safe. We may need to set an
+     * atomic/volatile bit so all local transporters abort.
+     */
+    ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
+
+    auto& step = *step_;
+    StepperResult track_counts;
+    if (!primaries->empty())
+    {
+        if (dump_)
+        {
+            // Write offload particles if user requested
+            (*dump_)(*primaries);
+        }
+
+        // Copy buffered tracks to device and transport the first step
+        track_counts = step(make_span(*primaries));
+        primaries->clear();
+    }
+    else
+    {
+        // Continue transporting tracks left over from a partial flush
+        track_counts = step();
+    }
+    ++step_iters_;
+
+    while (track_counts && !stop_early(track_counts))
+    {
+        CELER_VALIDATE(step_iters_ < inp_.max_steps,
+                       << "number of step iterations exceeded the allowed "
+                          "maximum ("
+                       << inp_.max_steps << ")");
+
+        track_counts = step();
+        ++step_iters_;
+
+        CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
+    }
+    return track_counts;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
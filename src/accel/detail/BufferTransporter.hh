@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/BufferTransporter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class StepperInterface;
+struct StepperResult;
+
+namespace detail
+{
+class OffloadWriter;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step buffers of offloaded tracks with a Celeritas stepper.
+ *
+ * A full flush adds the buffered tracks to the state and steps until no
+ * tracks remain. A \em partial flush (when \c flush_steps is nonzero) instead
+ * stops after that many step iterations, leaving the surviving tracks in the
+ * state to be stepped along with the next buffer. Stepping continues past the
+ * limit while the pending track initializers would leave no room for another
+ * buffer of \c buffer_size tracks. The \c max_steps limit applies to the
+ * iterations since the state was last empty.
+ */
+class BufferTransporter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPStepper = std::shared_ptr<StepperInterface>;
+    using SPOffloadWriter = std::shared_ptr<OffloadWriter>;
+    using VecPrimary = std::vector<Primary>;
+    //!@}
+
+    struct Input
+    {
+        size_type max_steps{};  //!< Step iterations before the state empties
+        size_type buffer_size{};  //!< Tracks added by each partial flush
+        size_type flush_steps{};  //!< Step iterations per partial flush
+        size_type init_capacity{};  //!< Maximum pending track initializers
+    };
+
+  public:
+    // Construct with stepper and optional offload writer
+    BufferTransporter(SPStepper step, Input const& inp, SPOffloadWriter dump);
+
+    // Transport buffered and active tracks to completion
+    void flush(VecPrimary* primaries);
+
+    // Add buffered tracks and run a limited number of step iterations
+    void partial_flush(VecPrimary* primaries);
+
+    //! Whether partial flushing is enabled
+    bool partial() const { return inp_.flush_steps > 0; }
+
+    //! Whether tracks were left in the state by a partial flush
+    bool tracks_active() const { return tracks_active_; }
+
+    //! Step iterations since the state was last empty
+    size_type step_iters() const { return step_iters_; }
+
+  private:
+    SPStepper step_;
+    Input inp_;
+    SPOffloadWriter dump_;
+    size_type step_iters_{};
+    bool tracks_active_{false};
+
+    template<class F>
+    StepperResult transport(VecPrimary* primaries, F&& stop_early);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
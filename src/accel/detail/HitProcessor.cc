@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "HitProcessor.hh"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <CLHEP/Units/SystemOfUnits.h>
@@ -23,6 +24,7 @@
 
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/io/Logger.hh"
 #include "geocel/g4/Convert.geant.hh"
 #include "celeritas/Quantities.hh"
@@ -32,6 +34,7 @@
 #include "celeritas/user/StepData.hh"
 
 #include "TouchableUpdater.hh"
+#include "../BatchHitInterface.hh"
 
 namespace celeritas
 {
@@ -117,6 +120,7 @@ HitProcessor::HitProcessor(SPConstVecLV detector_volumes,
 
     // Convert logical volumes (global) to sensitive detectors (thread local)
     detectors_.resize(detector_volumes_->size());
+    batch_detectors_.resize(detectors_.size());
     for (auto i : range(detectors_.size()))
     {
         G4LogicalVolume const* lv = (*detector_volumes_)[i];
@@ -126,6 +130,18 @@ HitProcessor::HitProcessor(SPConstVecLV detector_volumes,
                        << "no sensitive detector is attached to volume '"
                        << lv->GetName() << "'@"
                        << static_cast<void const*>(lv));
+        batch_detectors_[i] = dynamic_cast<BatchHitInterface*>(detectors_[i]);
+    }
+    if (std::any_of(batch_detectors_.begin(),
+                    batch_detectors_.end(),
+                    [](BatchHitInterface* b) { return b != nullptr; }))
+    {
+        offsets_.resize(detectors_.size() + 1);
+    }
+    else
+    {
+        // Send all hits in step order without grouping
+        batch_detectors_.clear();
     }
 
     CELER_ENSURE(!detectors_.empty());
@@ -153,10 +169,7 @@ HitProcessor::~HitProcessor()
 void HitProcessor::operator()(StepStateHostRef const& states)
 {
     copy_steps(&steps_, states);
-    if (steps_)
-    {
-        (*this)(steps_);
-    }
+    this->process_steps();
 }
 
 //---------------------------------------------------------------------------//
@@ -166,21 +179,99 @@ void HitProcessor::operator()(StepStateHostRef const& states)
 void HitProcessor::operator()(StepStateDeviceRef const& states)
 {
     copy_steps(&steps_, states);
-    if (steps_)
+    this->process_steps();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate and call hits from a detector output (for testing).
+ *
+ * In an application setting, hits are generated from our local copy \c steps_
+ * of the step data. For tests, we can call this function explicitly using
+ * local test data; if hits are deferred, the data is copied and dispatched.
+ */
+void HitProcessor::operator()(DetectorStepOutput const& out)
+{
+    if (dispatch_)
     {
-        (*this)(steps_);
+        steps_ = out;
+        this->process_steps();
+        return;
     }
+    this->send_hits(out);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Generate and call hits from a detector output.
+ * Send copied steps to Geant4, possibly through the owning thread.
+ */
+void HitProcessor::process_steps()
+{
+    if (!steps_)
+    {
+        return;
+    }
+    if (!dispatch_)
+    {
+        this->send_hits(steps_);
+        return;
+    }
+
+    // Hand off the steps to be processed on the owning thread, swapping in a
+    // recycled buffer so that both keep their capacity
+    DetectorStepOutput* steps = this->acquire_buffer();
+    std::swap(*steps, steps_);
+    dispatch_([this, steps] {
+        try
+        {
+            this->send_hits(*steps);
+        }
+        catch (...)
+        {
+            this->release_buffer(steps);
+            throw;
+        }
+        this->release_buffer(steps);
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a step buffer that isn't in use by a deferred task.
  *
- * In an application setting, this is always called with our local data \c
- * steps_ as an argument. For tests, we can call this function explicitly using
- * local test data.
+ * A new buffer is only allocated if every existing one is pending.
+ */
+DetectorStepOutput* HitProcessor::acquire_buffer()
+{
+    std::lock_guard scoped_lock{buffer_mutex_};
+    if (free_buffers_.empty())
+    {
+        step_buffers_.push_back(std::make_unique<DetectorStepOutput>());
+        // Releasing buffers must not allocate
+        free_buffers_.reserve(step_buffers_.size());
+        return step_buffers_.back().get();
+    }
+    DetectorStepOutput* result = free_buffers_.back();
+    free_buffers_.pop_back();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return a step buffer after its deferred task completes.
+ */
+void HitProcessor::release_buffer(DetectorStepOutput* steps)
+{
+    CELER_EXPECT(steps);
+    std::lock_guard scoped_lock{buffer_mutex_};
+    free_buffers_.push_back(steps);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate and call hits from a detector output.
  */
-void HitProcessor::operator()(DetectorStepOutput const& out) const
+void HitProcessor::send_hits(DetectorStepOutput const& out)
 {
     CELER_EXPECT(!out.detector.empty());
     CELER_ASSERT(!navi_ || !out.points[StepPoint::pre].pos.empty());
@@ -189,11 +280,82 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
 
     CELER_LOG_LOCAL(debug) << "Processing " << out.size() << " hits";
 
-    EnumArray<StepPoint, G4StepPoint*> points
-        = {step_->GetPreStepPoint(), step_->GetPostStepPoint()};
+    if (batch_detectors_.empty())
+    {
+        for (auto i : range(out.size()))
+        {
+            this->process_hit(out, i);
+        }
+        return;
+    }
+
+    this->sort_by_detector(out);
+    for (auto det_idx : range(detectors_.size()))
+    {
+        BatchHitInterface* batch = batch_detectors_[det_idx];
+        Span<size_type const> indices{indices_.data() + offsets_[det_idx],
+                                      indices_.data() + offsets_[det_idx + 1]};
+        if (batch && !indices.empty())
+        {
+            // Send all the steps in this detector at once
+            batch->ProcessHits(out, indices);
+        }
+    }
+
+    // Send the other hits in step order
+    for (auto i : range(out.size()))
+    {
+        if (!batch_detectors_[out.detector[i].unchecked_get()])
+        {
+            this->process_hit(out, i);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Group step indices by detector ID, preserving their order.
+ *
+ * This is a counting sort into reused scratch space.
+ */
+void HitProcessor::sort_by_detector(DetectorStepOutput const& out)
+{
+    std::fill(offsets_.begin(), offsets_.end(), size_type{0});
+    for (DetectorId did : out.detector)
+    {
+        CELER_ASSERT(did < detectors_.size());
+        ++offsets_[did.unchecked_get() + 1];
+    }
+    for (auto det_idx : range(detectors_.size()))
+    {
+        offsets_[det_idx + 1] += offsets_[det_idx];
+    }
 
+    // Use the final offset of each detector as its insertion point
+    indices_.resize(out.size());
     for (auto i : range(out.size()))
     {
+        auto& pos = offsets_[out.detector[i].unchecked_get()];
+        indices_[pos++] = i;
+    }
+
+    // Shift the insertion points back to the start of each group
+    for (auto det_idx = detectors_.size(); det_idx > 0; --det_idx)
+    {
+        offsets_[det_idx] = offsets_[det_idx - 1];
+    }
+    offsets_.front() = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reconstruct a single step and send it to its sensitive detector.
+ */
+void HitProcessor::process_hit(DetectorStepOutput const& out, size_type i) const
+{
+    EnumArray<StepPoint, G4StepPoint*> points
+        = {step_->GetPreStepPoint(), step_->GetPostStepPoint()};
+
 #define HP_SET(SETTER, OUT, UNITS)                   \
     do                                               \
     {                                                \
@@ -203,61 +365,58 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
         }                                            \
     } while (0)
 
-        HP_SET(step_->SetTotalEnergyDeposit, out.energy_deposition, CLHEP::MeV);
+    HP_SET(step_->SetTotalEnergyDeposit, out.energy_deposition, CLHEP::MeV);
 
-        for (auto sp : range(StepPoint::size_))
+    for (auto sp : range(StepPoint::size_))
+    {
+        if (!points[sp])
         {
-            if (!points[sp])
-            {
-                continue;
-            }
-            HP_SET(points[sp]->SetGlobalTime, out.points[sp].time, clhep_time);
-            HP_SET(points[sp]->SetPosition, out.points[sp].pos, clhep_length);
-            HP_SET(points[sp]->SetKineticEnergy,
-                   out.points[sp].energy,
-                   CLHEP::MeV);
-            HP_SET(points[sp]->SetMomentumDirection, out.points[sp].dir, 1);
-            /*!
-             * \todo Celeritas currently ignores incoming particle weight and
-             * does not perform any variance reduction. See issue #1268.
-             */
-            points[sp]->SetWeight(1.0);
+            continue;
         }
+        HP_SET(points[sp]->SetGlobalTime, out.points[sp].time, clhep_time);
+        HP_SET(points[sp]->SetPosition, out.points[sp].pos, clhep_length);
+        HP_SET(points[sp]->SetKineticEnergy, out.points[sp].energy, CLHEP::MeV);
+        HP_SET(points[sp]->SetMomentumDirection, out.points[sp].dir, 1);
+        /*!
+         * \todo Celeritas currently ignores incoming particle weight and
+         * does not perform any variance reduction. See issue #1268.
+         */
+        points[sp]->SetWeight(1.0);
+    }
 #undef HP_SET
 
-        if (navi_)
-        {
-            G4LogicalVolume const* lv = this->detector_volume(out.detector[i]);
-
-            // Update navigation state
-            constexpr auto sp = StepPoint::pre;
-            TouchableUpdater update_touchable{navi_.get(), touch_handle_()};
-
-            bool success = update_touchable(
-                out.points[sp].pos[i], out.points[sp].dir[i], lv);
-            if (CELER_UNLIKELY(!success))
-            {
-                // Inconsistent touchable: skip this energy deposition
-                CELER_LOG_LOCAL(error)
-                    << "Omitting energy deposition of "
-                    << step_->GetTotalEnergyDeposit() / CLHEP::MeV << " [MeV]";
-                continue;
-            }
-
-            // Copy attributes from logical volume
-            points[sp]->SetMaterial(lv->GetMaterial());
-            points[sp]->SetMaterialCutsCouple(lv->GetMaterialCutsCouple());
-            points[sp]->SetSensitiveDetector(lv->GetSensitiveDetector());
-        }
+    if (navi_)
+    {
+        G4LogicalVolume const* lv = this->detector_volume(out.detector[i]);
 
-        if (!tracks_.empty())
+        // Update navigation state
+        constexpr auto sp = StepPoint::pre;
+        TouchableUpdater update_touchable{navi_.get(), touch_handle_()};
+
+        bool success = update_touchable(
+            out.points[sp].pos[i], out.points[sp].dir[i], lv);
+        if (CELER_UNLIKELY(!success))
         {
-            this->update_track(out.particle[i]);
+            // Inconsistent touchable: skip this energy deposition
+            CELER_LOG_LOCAL(error)
+                << "Omitting energy deposition of "
+                << step_->GetTotalEnergyDeposit() / CLHEP::MeV << " [MeV]";
+            return;
         }
 
-        // Hit sensitive detector
-        this->detector(out.detector[i])->Hit(step_.get());
+        // Copy attributes from logical volume
+        points[sp]->SetMaterial(lv->GetMaterial());
+        points[sp]->SetMaterialCutsCouple(lv->GetMaterialCutsCouple());
+        points[sp]->SetSensitiveDetector(lv->GetSensitiveDetector());
     }
+
+    if (!tracks_.empty())
+    {
+        this->update_track(out.particle[i]);
+    }
+
+    // Hit sensitive detector
+    this->detector(out.detector[i])->Hit(step_.get());
 }
 
 //---------------------------------------------------------------------------//
@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <G4TouchableHandle.hh>
@@ -27,6 +29,7 @@ namespace celeritas
 {
 struct StepSelection;
 struct DetectorStepOutput;
+class BatchHitInterface;
 
 namespace detail
 {
@@ -43,10 +46,29 @@ namespace detail
  * class \b must be destroyed on the same thread on which it was created.
  *
  * Call operator:
- * - Loop over detector steps
- * - Update step attributes based on hit selection for the detector (TODO:
- *   selection is global for now)
- * - Call the local detector (based on detector ID from map) with the step
+ * - If any detector implements \c BatchHitInterface , group its steps
+ *   (preserving their order) and send each group to it at once
+ * - For each remaining step, in step order, update step attributes based on
+ *   hit selection for the detector (TODO: selection is global for now) and
+ *   call the local detector (based on detector ID from map) with the step
+ *
+ * Steps are only grouped when a batch detector is present, so applications
+ * without one see hits in exactly the order the steps were produced. The
+ * grouping scratch space is kept between calls so that processing does not
+ * allocate.
+ *
+ * \note With a batch detector, its hits from each set of steps are delivered
+ * before the hits of the other detectors. Within a detector, the step order
+ * is always preserved.
+ *
+ * When hits are \em deferred, the step call operators may be called from a
+ * thread other than the one that owns the sensitive detectors. They copy the
+ * detector steps and pass a task that sends them to Geant4 to a dispatch
+ * function, which must run it on the owning thread. The dispatcher is
+ * responsible for running the tasks in order and for bounding the number of
+ * copies that are pending. Each copy is swapped into a buffer that is
+ * returned for reuse when its task completes, so once there are as many
+ * buffers as pending tasks, deferring hits no longer allocates.
  */
 class HitProcessor
 {
@@ -58,6 +80,8 @@ class HitProcessor
     using SPConstVecLV
         = std::shared_ptr<std::vector<G4LogicalVolume const*> const>;
     using VecParticle = std::vector<G4ParticleDefinition const*>;
+    using Task = std::function<void()>;
+    using DispatchTask = std::function<void(Task)>;
     //!@}
 
   public:
@@ -78,7 +102,10 @@ class HitProcessor
     void operator()(StepStateDeviceRef const&);
 
     // Generate and call hits from a detector output (for testing)
-    void operator()(DetectorStepOutput const& out) const;
+    void operator()(DetectorStepOutput const& out);
+
+    //! Send hits to Geant4 via the owning thread (null for immediately)
+    void defer_hits(DispatchTask dispatch) { dispatch_ = std::move(dispatch); }
 
     // Access detector volume corresponding to an ID
     inline G4LogicalVolume const* detector_volume(DetectorId) const;
@@ -91,8 +118,21 @@ class HitProcessor
     SPConstVecLV detector_volumes_;
     //! Map detector IDs to sensitive detectors
     std::vector<G4VSensitiveDetector*> detectors_;
+    //! Sensitive detectors that accept batches of hits (empty if none do)
+    std::vector<BatchHitInterface*> batch_detectors_;
     //! Temporary CPU hit information
     DetectorStepOutput steps_;
+    //! Run hit processing on the thread that owns the detectors
+    DispatchTask dispatch_;
+    //! Step indices grouped by detector
+    std::vector<size_type> indices_;
+    //! Start of each detector's group of indices
+    std::vector<size_type> offsets_;
+    //! Step copies for deferred hits, owned here and lent to the tasks
+    std::vector<std::unique_ptr<DetectorStepOutput>> step_buffers_;
+    //! Step copies whose tasks have completed
+    std::vector<DetectorStepOutput*> free_buffers_;
+    std::mutex buffer_mutex_;
 
     //! Temporary step
     std::unique_ptr<G4Step> step_;
@@ -109,6 +149,12 @@ class HitProcessor
     //! Stream ID
     StreamId stream_;
 
+    void process_steps();
+    DetectorStepOutput* acquire_buffer();
+    void release_buffer(DetectorStepOutput* steps);
+    void send_hits(DetectorStepOutput const& out);
+    void sort_by_detector(DetectorStepOutput const& out);
+    void process_hit(DetectorStepOutput const& out, size_type i) const;
     void update_track(ParticleId id) const;
 };
 
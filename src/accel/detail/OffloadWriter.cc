@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadWriter.cc
+//---------------------------------------------------------------------------//
+#include "OffloadWriter.hh"
+
+#include <exception>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a writer and the number of streams.
+ */
+OffloadWriter::OffloadWriter(UPWriter&& writer, size_type num_streams)
+    : write_event_{std::move(writer)}
+    , queue_{max_queued * num_streams,
+             [this](VecPrimary& primaries) { (*write_event_)(primaries); }}
+{
+    CELER_EXPECT(write_event_);
+    CELER_EXPECT(num_streams > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write remaining primaries and stop the background thread.
+ */
+OffloadWriter::~OffloadWriter()
+{
+    try
+    {
+        this->finalize();
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(error) << "Failed to write offloaded primaries: "
+                         << e.what();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue primaries to be written.
+ *
+ * This blocks while the queue is full. An error from writing previously
+ * queued primaries is rethrown here.
+ */
+void OffloadWriter::operator()(argument_type primaries)
+{
+    queue_.push(primaries);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write remaining primaries and rethrow any error.
+ */
+void OffloadWriter::finalize()
+{
+    queue_.wait();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -8,8 +8,10 @@
 #pragma once
 
 #include <memory>
-#include <mutex>
 
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/WorkQueue.hh"
 #include "celeritas/io/EventIOInterface.hh"
 
 namespace celeritas
@@ -20,7 +22,18 @@ namespace detail
 /*!
  * Dump primaries to a shared file, one event per flush.
  *
- * This thin class simply adds a mutex to the output writer for thread safety.
+ * All streams share a single mutex-guarded \c WorkQueue , whose background
+ * thread writes the events in the order they were queued. The mutex is only
+ * held to append or remove an event, so callers don't wait on I/O unless the
+ * queue is full. Its capacity is \c max_queued events per stream, so that a
+ * slow disk slows down transport instead of exhausting memory. Since each
+ * stream queues its events sequentially, events from a single stream are
+ * written in order.
+ *
+ * An exception thrown by the output writer is rethrown by the next call to
+ * queue primaries or by \c finalize , and events queued before then are
+ * discarded. The destructor writes any remaining events but can only log an
+ * error.
  */
 class OffloadWriter
 {
@@ -32,38 +45,32 @@ class OffloadWriter
     //!@}
 
   public:
-    // Construct from a writer interface
-    inline explicit OffloadWriter(UPWriter&& writer);
+    //! Maximum number of events waiting to be written, per stream
+    static constexpr size_type max_queued = 2;
+
+  public:
+    // Construct from a writer interface and the number of streams
+    OffloadWriter(UPWriter&& writer, size_type num_streams);
+
+    // Write remaining primaries and stop the background thread
+    ~OffloadWriter();
+
+    //! Prevent copying and moving since the queue calls back into this
+    CELER_DELETE_COPY_MOVE(OffloadWriter);
 
-    // Write primaries
-    inline void operator()(argument_type);
+    // Queue primaries to be written
+    void operator()(argument_type primaries);
+
+    // Write remaining primaries and rethrow any error
+    void finalize();
 
   private:
-    std::mutex write_mutex_;
+    using VecPrimary = EventWriterInterface::VecPrimary;
+
     UPWriter write_event_;
+    WorkQueue<VecPrimary> queue_;
 };
 
-//---------------------------------------------------------------------------//
-// INLINE DEFINITIONS
-//---------------------------------------------------------------------------//
-/*!
- * Construct from a writer.
- */
-OffloadWriter::OffloadWriter(UPWriter&& writer)
-    : write_event_{std::move(writer)}
-{
-}
-
-//---------------------------------------------------------------------------//
-/*!
- * Write primaries using a mutex.
- */
-void OffloadWriter::operator()(argument_type primaries)
-{
-    std::lock_guard scoped_lock{write_mutex_};
-    (*write_event_)(primaries);
-}
-
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
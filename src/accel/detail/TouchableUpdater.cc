@@ -8,8 +8,12 @@
 #include "TouchableUpdater.hh"
 
 #include <CLHEP/Units/SystemOfUnits.h>
+#include <G4AffineTransform.hh>
+#include <G4LogicalVolume.hh>
+#include <G4NavigationHistory.hh>
 #include <G4Navigator.hh>
 #include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
 #include <G4VTouchable.hh>
 
 #include "corecel/io/Logger.hh"
@@ -61,6 +65,12 @@ bool TouchableUpdater::operator()(Real3 const& pos,
     auto g4pos = convert_to_geant(pos, clhep_length);
     auto g4dir = convert_to_geant(dir, 1);
 
+    if (this->in_current_volume(g4pos, lv))
+    {
+        // Consecutive hits in the same detector element: state is unchanged
+        return true;
+    }
+
     // Locate pre-step point
     navi_->LocateGlobalPointAndUpdateTouchable(g4pos,
                                                g4dir,
@@ -176,6 +186,32 @@ bool TouchableUpdater::operator()(Real3 const& pos,
     return false;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the point is strictly inside the current leaf volume.
+ *
+ * If the touchable's current volume is the target logical volume, has no
+ * daughters, and is not parameterised, then any point inside its solid has
+ * the same navigation state. This is only a single coordinate transform and
+ * "inside" test compared to a full relocation from the world volume.
+ */
+bool TouchableUpdater::in_current_volume(G4ThreeVector const& pos,
+                                         G4LogicalVolume const* lv) const
+{
+    G4VPhysicalVolume const* pv = touchable_->GetVolume(0);
+    if (!pv || pv->GetLogicalVolume() != lv || lv->GetNoDaughters() != 0)
+    {
+        return false;
+    }
+    G4NavigationHistory const* history = touchable_->GetHistory();
+    if (!history || history->GetTopVolumeType() == kParameterised)
+    {
+        return false;
+    }
+    G4ThreeVector local = history->GetTopTransform().TransformPoint(pos);
+    return lv->GetSolid()->Inside(local) == kInside;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
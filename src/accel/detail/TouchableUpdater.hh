@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <G4ThreeVector.hh>
+
 #include "geocel/GeantGeoUtils.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/Units.hh"
@@ -19,7 +21,9 @@ namespace detail
 /*!
  * Update the temporary navigation state based on the position and direction.
  *
- * This is a helper class for \c HitProcessor.
+ * This is a helper class for \c HitProcessor. If the touchable is already in
+ * the target volume from a previous update, and the point is inside it, the
+ * navigator is not called.
  */
 class TouchableUpdater
 {
@@ -43,6 +47,10 @@ class TouchableUpdater
   private:
     G4Navigator* navi_;
     GeantTouchableBase* touchable_;
+
+    // Whether the point is strictly inside the current leaf volume
+    bool in_current_volume(G4ThreeVector const& pos,
+                           G4LogicalVolume const* lv) const;
 };
 
 //---------------------------------------------------------------------------//
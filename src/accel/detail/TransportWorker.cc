@@ -0,0 +1,195 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/TransportWorker.cc
+//---------------------------------------------------------------------------//
+#include "TransportWorker.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Start the thread, running an initialization task on it.
+ *
+ * An exception from the initialization task is rethrown by the first \c wait.
+ */
+TransportWorker::TransportWorker(Task initialize, size_type max_owner_tasks)
+    : max_owner_tasks_{max_owner_tasks}
+    , owner_id_{std::this_thread::get_id()}
+    , tasks_{max_queued_tasks, [this](Task& task) { this->run(task); }}
+{
+    CELER_EXPECT(max_owner_tasks_ > 0);
+
+    if (initialize)
+    {
+        tasks_.push(std::move(initialize));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Discard pending tasks and join the thread.
+ *
+ * A task that is already running is allowed to finish, but any tasks it sends
+ * to the owner are dropped.
+ */
+TransportWorker::~TransportWorker()
+{
+    {
+        std::lock_guard scoped_lock{owner_mutex_};
+        stop_ = true;
+        owner_tasks_.clear();
+    }
+    owner_changed_.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue a task for the background thread.
+ */
+void TransportWorker::push(Task task)
+{
+    CELER_EXPECT(task);
+    tasks_.push(std::move(task));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue a task for the owning thread, blocking while too many are pending.
+ */
+void TransportWorker::call_owner(Task task)
+{
+    CELER_EXPECT(task);
+    if (std::this_thread::get_id() == owner_id_)
+    {
+        // Preserve the order of tasks already sent by the background thread
+        this->poll();
+        task();
+        return;
+    }
+    this->send_owner(std::move(task));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Run tasks queued for the owning thread.
+ *
+ * Each task is run without holding the lock so that the background thread can
+ * continue queueing. The end-of-wait marker is left for \c wait .
+ */
+void TransportWorker::poll()
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::lock_guard scoped_lock{owner_mutex_};
+            if (owner_tasks_.empty() || !owner_tasks_.front())
+            {
+                return;
+            }
+            task = std::move(owner_tasks_.front());
+            owner_tasks_.pop_front();
+        }
+        owner_changed_.notify_all();
+        task();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all tasks to complete while running tasks for the owner.
+ *
+ * An empty task is queued behind the pending ones: when the background thread
+ * reaches it, it sends an empty task back, and every owner task sent before
+ * then has been run. An exception thrown by a background task is rethrown
+ * here.
+ */
+void TransportWorker::wait()
+{
+    tasks_.push({});
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock lock{owner_mutex_};
+            owner_changed_.wait(lock, [this] { return !owner_tasks_.empty(); });
+            task = std::move(owner_tasks_.front());
+            owner_tasks_.pop_front();
+            if (!task)
+            {
+                if (auto e = std::exchange(exception_, nullptr))
+                {
+                    std::rethrow_exception(e);
+                }
+                return;
+            }
+        }
+        owner_changed_.notify_all();
+        task();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Run a task on the background thread.
+ *
+ * After a failure, tasks are discarded until the owner sees the exception.
+ */
+void TransportWorker::run(Task& task)
+{
+    if (!task)
+    {
+        // End of a wait: hand control back to the owner
+        this->send_owner({});
+        return;
+    }
+    {
+        std::lock_guard scoped_lock{owner_mutex_};
+        if (exception_)
+        {
+            return;
+        }
+    }
+    try
+    {
+        task();
+    }
+    catch (...)
+    {
+        std::lock_guard scoped_lock{owner_mutex_};
+        exception_ = std::current_exception();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Send a task to the owner from the background thread.
+ */
+void TransportWorker::send_owner(Task task)
+{
+    {
+        std::unique_lock lock{owner_mutex_};
+        owner_changed_.wait(lock, [this] {
+            return stop_ || owner_tasks_.size() < max_owner_tasks_;
+        });
+        if (stop_)
+        {
+            return;
+        }
+        owner_tasks_.push_back(std::move(task));
+    }
+    owner_changed_.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/TransportWorker.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/WorkQueue.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Run tasks in order on a single long-lived background thread.
+ *
+ * The thread that creates the worker (the "owner") queues tasks with \c push
+ * and waits for them with \c wait . Tasks on the background thread can send
+ * work back to the owner with \c call_owner : for example, sensitive detector
+ * hits must be processed on the Geant4 worker thread that owns the detectors.
+ * At most \c max_owner_tasks such tasks are pending at once: when the limit
+ * is reached, the background thread blocks until the owner runs them with
+ * \c poll or \c wait . If \c call_owner is called from the owning thread
+ * itself, the task is run immediately after any pending ones.
+ *
+ * If a task throws, the exception is rethrown to the owner by the next call to
+ * \c wait , and tasks queued before then are discarded.
+ *
+ * Background tasks are run by a \c WorkQueue that holds up to
+ * \c max_queued_tasks of them: since \c push doesn't run owner tasks while it
+ * blocks, the owner should \c wait before queueing more than that.
+ *
+ * \code
+   TransportWorker worker([] { activate_device_local(); }, 16);
+   worker.push([&step] { step(); });
+   worker.wait();
+   \endcode
+ */
+class TransportWorker
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Task = std::function<void()>;
+    //!@}
+
+  public:
+    //! Maximum number of tasks waiting for the background thread
+    static constexpr size_type max_queued_tasks = 4;
+
+  public:
+    // Start the thread, running an initialization task on it
+    TransportWorker(Task initialize, size_type max_owner_tasks);
+
+    // Discard pending tasks and join the thread
+    ~TransportWorker();
+
+    //! Prevent copying and moving since queued tasks point to this
+    CELER_DELETE_COPY_MOVE(TransportWorker);
+
+    // Queue a task for the background thread
+    void push(Task task);
+
+    // Queue a task for the owning thread, blocking while too many are pending
+    void call_owner(Task task);
+
+    // Run tasks queued for the owning thread
+    void poll();
+
+    // Wait for all tasks to complete while running tasks for the owner
+    void wait();
+
+  private:
+    size_type max_owner_tasks_;
+    std::thread::id owner_id_;
+
+    // Tasks sent back to the owner: an empty task marks the end of a wait
+    std::mutex owner_mutex_;
+    std::condition_variable owner_changed_;
+    std::deque<Task> owner_tasks_;
+    bool stop_{false};
+    std::exception_ptr exception_;
+
+    // Destroyed first so that running tasks can still reach the owner
+    WorkQueue<Task> tasks_;
+
+    // Run a task on the background thread
+    void run(Task& task);
+
+    // Send a task to the owner from the background thread
+    void send_owner(Task task);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -59,6 +59,7 @@ char const* to_cstring(TrackOrder value)
         "sort_step_limit_action",
         "sort_action",
         "sort_particle_type",
+        "sort_material",
     };
     return to_cstring_impl(value);
 }
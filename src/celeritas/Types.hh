@@ -141,6 +141,7 @@ enum class TrackOrder
     sort_step_limit_action,  //!< Sort only by the step limit action id
     sort_action,  //!< Sort by along-step id, then post-step ID
     sort_particle_type,  //!< Sort by particle type
+    sort_material,  //!< Sort by current material
     size_
 };
 
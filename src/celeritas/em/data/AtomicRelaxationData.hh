@@ -14,6 +14,7 @@
 #include "corecel/data/CollectionBuilder.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/random/Selector.hh"
 
 namespace celeritas
 {
@@ -33,10 +34,15 @@ struct AtomicRelaxTransition
 //---------------------------------------------------------------------------//
 /*!
  * Electron subshell data.
+ *
+ * The alias table has one more entry than the number of transitions: the
+ * last one is the probability that no transition occurs (e.g. when Auger
+ * transitions are disabled).
  */
 struct AtomicRelaxSubshell
 {
     ItemRange<AtomicRelaxTransition> transitions;
+    ItemRange<AliasTableEntry> select_transition;
 };
 
 //---------------------------------------------------------------------------//
@@ -80,6 +86,7 @@ struct AtomicRelaxParamsData
 
     AtomicRelaxIds ids;
     Items<AtomicRelaxTransition> transitions;
+    Items<AliasTableEntry> alias_tables;
     Items<AtomicRelaxSubshell> shells;
     ElementItems<AtomicRelaxElement> elements;
     size_type max_stack_size{};
@@ -99,6 +106,7 @@ struct AtomicRelaxParamsData
     {
         ids = other.ids;
         transitions = other.transitions;
+        alias_tables = other.alias_tables;
         shells = other.shells;
         elements = other.elements;
         max_stack_size = other.max_stack_size;
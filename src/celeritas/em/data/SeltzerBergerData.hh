@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstdint>
+
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
@@ -30,8 +32,16 @@ namespace celeritas
  * \c argmax is the y index of the largest cross section at a given incident
  * energy point.
  *
- * \todo We could use way smaller integers for argmax, even i/j here, because
- * these tables are so small.
+ * The optional \c bin_max and \c cdf tables describe a piecewise envelope of
+ * the sampling distribution \f$ \chi(\kappa) / \kappa \f$ at each incident
+ * energy point: \c bin_max is the larger of the two cross sections bounding
+ * each \em y interval, and \c cdf is the cumulative integral of \c bin_max
+ * / \f$ \kappa \f$ from the lowest \em y grid point. They are empty unless
+ * tabulated sampling is enabled.
+ *
+ * Since the tables are small, \c argmax is always stored as a 16-bit index
+ * (independently of the compact physics table option): setup fails if a
+ * table has more than 65536 \em y points.
  */
 struct SBElementTableData
 {
@@ -39,12 +49,19 @@ struct SBElementTableData
     using XsUnits = units::Millibarn;
 
     TwodGridData grid;  //!< Cross section grid and data
-    ItemRange<size_type> argmax;  //!< Y index of the largest XS for each
-                                  //!< energy
+    ItemRange<std::uint16_t> argmax;  //!< Y index of the largest XS for
+                                      //!< each energy
+    ItemRange<real_type> bin_max;  //!< Largest XS in each y interval [x][y]
+    ItemRange<real_type> cdf;  //!< Integrated envelope at each y [x][y]
+
+    //! Whether the sampling envelope is tabulated
+    CELER_FUNCTION bool has_cdf() const { return !cdf.empty(); }
 
     explicit CELER_FUNCTION operator bool() const
     {
-        return grid && argmax.size() == grid.x.size();
+        return grid && argmax.size() == grid.x.size()
+               && bin_max.size() == cdf.size()
+               && (cdf.empty() || cdf.size() == grid.values.size());
     }
 };
 
@@ -70,7 +87,7 @@ struct SeltzerBergerTableData
     //// MEMBER DATA ////
 
     Items<real_type> reals;
-    Items<size_type> sizes;
+    Items<std::uint16_t> sizes;
     ElementItems<SBElementTableData> elements;
 
     //// MEMBER FUNCTIONS ////
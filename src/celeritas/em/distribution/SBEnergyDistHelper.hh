@@ -9,11 +9,13 @@
 
 #include <cmath>
 
+#include "corecel/grid/NonuniformGrid.hh"
 #include "corecel/grid/TwodGridCalculator.hh"
 #include "corecel/grid/TwodSubgridCalculator.hh"
 #include "corecel/math/Algorithms.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/data/SeltzerBergerData.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
 #include "celeritas/random/distribution/ReciprocalDistribution.hh"
 
 namespace celeritas
@@ -29,6 +31,14 @@ namespace celeritas
  * The cross section units are immaterial since the cross section merely acts
  * as a shape function for rejection: the sampled energy's cross section is
  * always divided by the maximium cross section.
+ *
+ * If the element's table has a tabulated envelope (see \c
+ * SBElementTableData), \c sample_envelope can be used in place of \c
+ * sample_exit_energy and \c max_xs. The envelope is a piecewise-constant
+ * bound on the cross section over each \em y interval, interpolated in
+ * incident energy, times the \f$ 1/\kappa \f$ factor. Sampling it is a
+ * table lookup and inversion, and the rejection against the true cross section
+ * almost always accepts because the bound is tight on each interval.
  */
 class SBEnergyDistHelper
 {
@@ -41,6 +51,14 @@ class SBEnergyDistHelper
     using EnergySq = Quantity<UnitProduct<units::Mev, units::Mev>>;
     //!@}
 
+    //! Exit energy sampled from the tabulated envelope
+    struct EnvelopeSample
+    {
+        Energy energy;  //!< Sampled exit energy
+        Xs xs;  //!< Tabulated cross section at the exit energy
+        Xs max_xs;  //!< Envelope value for rejection at the exit energy
+    };
+
   public:
     // Construct from data
     inline CELER_FUNCTION SBEnergyDistHelper(SBDXsec const& differential_xs,
@@ -59,6 +77,13 @@ class SBEnergyDistHelper
     //! Maximum cross section calculated for rejection
     CELER_FUNCTION Xs max_xs() const { return max_xs_; }
 
+    //! Whether the sampling envelope is tabulated
+    CELER_FUNCTION bool has_envelope() const { return element_.has_cdf(); }
+
+    // Sample the tabulated envelope of the exiting distribution
+    template<class Engine>
+    inline CELER_FUNCTION EnvelopeSample sample_envelope(Engine& rng) const;
+
   private:
     //// IMPLEMENTATION TYPES ////
 
@@ -74,6 +99,10 @@ class SBEnergyDistHelper
     real_type const dens_corr_;
     ReciprocalSampler const sample_exit_esq_;
 
+    SBTables const& xs_params_;
+    SBElementTableData const& element_;
+    real_type const min_frac_;
+
     //// CONSTRUCTION HELPER FUNCTIONS ////
 
     inline CELER_FUNCTION TwodSubgridCalculator make_xs_calc(
@@ -107,6 +136,9 @@ SBEnergyDistHelper::SBEnergyDistHelper(SBDXsec const& differential_xs,
     , dens_corr_(density_correction.value())
     , sample_exit_esq_{
           this->make_esq_sampler(inc_energy.value(), min_gamma_energy.value())}
+    , xs_params_{differential_xs}
+    , element_{differential_xs.elements[element]}
+    , min_frac_{min_gamma_energy.value() * inv_inc_energy_}
 {
     CELER_EXPECT(inc_energy > min_gamma_energy);
 }
@@ -125,6 +157,102 @@ SBEnergyDistHelper::sample_exit_energy(Engine& rng) const -> Energy
     return Energy{std::sqrt(esq)};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the tabulated envelope of the exiting distribution.
+ *
+ * The envelope's integral from the lowest \em y grid point is linearly
+ * interpolated between the two incident energy grid points. The interval
+ * containing the production cutoff is treated separately: its envelope
+ * includes the density correction, \f$ \kappa / (\kappa^2 + d_\rho) \f$,
+ * which matters mostly at low exiting energy, and its weight is calculated on
+ * the fly. Above it, a uniform sample of the tabulated integral is located in
+ * the \em y grid by bisection, then inverted exactly because the envelope is
+ * proportional to \f$ 1/\kappa \f$ in each interval.
+ */
+template<class Engine>
+CELER_FUNCTION auto
+SBEnergyDistHelper::sample_envelope(Engine& rng) const -> EnvelopeSample
+{
+    CELER_EXPECT(this->has_envelope());
+
+    NonuniformGrid<real_type> const y_grid{element_.grid.y, xs_params_.reals};
+    size_type const num_y = y_grid.size();
+    auto const cdf = xs_params_.reals[element_.cdf];
+    auto const bin_max = xs_params_.reals[element_.bin_max];
+    size_type const lower = calc_xs_.x_index() * num_y;
+    size_type const upper = lower + num_y;
+    real_type const x_frac = calc_xs_.x_fraction();
+    auto calc_cdf = [&](size_type j) {
+        return (1 - x_frac) * cdf[lower + j] + x_frac * cdf[upper + j];
+    };
+    auto calc_bin_max = [&](size_type j) {
+        return (1 - x_frac) * bin_max[lower + j] + x_frac * bin_max[upper + j];
+    };
+
+    // Density correction in units of the incident energy squared
+    real_type const dens_corr = dens_corr_ * ipow<2>(inv_inc_energy_);
+
+    // Weight of the interval containing the production cutoff
+    size_type j = y_grid.find(min_frac_);
+    real_type const min_esq = ipow<2>(min_frac_) + dens_corr;
+    real_type const cutoff_max_xs = calc_bin_max(j);
+    real_type const cutoff_weight
+        = cutoff_max_xs / 2
+          * std::log((ipow<2>(y_grid[j + 1]) + dens_corr) / min_esq);
+
+    // Sample the combined integral
+    real_type u = generate_canonical(rng)
+                  * (cutoff_weight + calc_cdf(num_y - 1) - calc_cdf(j + 1));
+
+    real_type kappa;
+    real_type max_xs;
+    if (u < cutoff_weight)
+    {
+        // Invert the density-corrected reciprocal distribution
+        kappa = std::sqrt(min_esq * std::exp(2 * u / cutoff_max_xs)
+                          - dens_corr);
+        max_xs = cutoff_max_xs;
+    }
+    else
+    {
+        // Find the interval [j, j + 1) containing the integral
+        u += calc_cdf(j + 1) - cutoff_weight;
+        size_type last = num_y - 1;
+        ++j;
+        while (last - j > 1)
+        {
+            size_type mid = j + (last - j) / 2;
+            if (calc_cdf(mid) <= u)
+            {
+                j = mid;
+            }
+            else
+            {
+                last = mid;
+            }
+        }
+
+        // Invert the integral of the envelope in the interval, and bound the
+        // density correction factor
+        max_xs = calc_bin_max(j);
+        CELER_ASSERT(max_xs > 0);
+        kappa = y_grid[j] * std::exp((u - calc_cdf(j)) / max_xs);
+        max_xs *= 1 + dens_corr / ipow<2>(kappa);
+    }
+
+    // Guard against roundoff at the interval boundaries
+    kappa = clamp(kappa,
+                  celeritas::max(min_frac_, y_grid[j]),
+                  std::nextafter(y_grid[j + 1], real_type{0}));
+
+    EnvelopeSample result;
+    result.energy = Energy{kappa / inv_inc_energy_};
+    result.xs = Xs{calc_xs_(kappa)};
+    result.max_xs = Xs{max_xs};
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate tabulated cross section for a given energy.
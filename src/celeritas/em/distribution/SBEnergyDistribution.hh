@@ -89,6 +89,14 @@ struct SBElectronXsCorrector
  \kappa_\mathrm{min}]) - d_\rho E^2}
  * \f]
  *
+ * If the SB tables include a tabulated envelope (built at setup time by \c
+ * SeltzerBergerModel), the analytic \f$ 1/\kappa \f$ sample is replaced
+ * by a sample from the piecewise envelope of \f$ \chi / \kappa \f$, which
+ * is a table lookup plus interpolation. The remaining rejection only accounts
+ * for the bilinear interpolation within an interval, the density correction,
+ * and the cross section correction, so it almost always accepts on the first
+ * try, reducing the variability of the loop count.
+ *
  * Most of the mechanics of the sampling are in the template-free
  * \c SBEnergyDistHelper, which is passed as a construction argument to this
  * sampler. The separate class exists here to minimize duplication of templated
@@ -145,10 +153,22 @@ template<class X>
 template<class Engine>
 CELER_FUNCTION auto SBEnergyDistribution<X>::operator()(Engine& rng) -> Energy
 {
-    // Sampled energy
-    Energy exit_energy;
     // Calculated cross section used inside rejection sampling
     real_type xs{};
+    if (helper_.has_envelope())
+    {
+        // Sample from the tabulated envelope
+        SBEnergyDistHelper::EnvelopeSample sample;
+        do
+        {
+            sample = helper_.sample_envelope(rng);
+            xs = sample.xs.value() * scale_xs_(sample.energy);
+        } while (RejectionSampler<>(xs, sample.max_xs.value())(rng));
+        return sample.energy;
+    }
+
+    // Sampled energy
+    Energy exit_energy;
     do
     {
         // Sample scaled energy and subtract correction factor
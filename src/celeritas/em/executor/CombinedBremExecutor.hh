@@ -40,9 +40,8 @@ CombinedBremExecutor::operator()(CoreTrackView const& track)
     // Select material track view
     auto material = track.make_material_view().make_material_view();
 
-    // Assume only a single element in the material, for now
-    CELER_ASSERT(material.num_elements() == 1);
-    ElementComponentId const selected_element{0};
+    auto elcomp_id = track.make_physics_step_view().element();
+    CELER_ASSERT(elcomp_id);
 
     auto particle = track.make_particle_view();
     auto const& dir = track.make_geo_view().dir();
@@ -56,7 +55,7 @@ CombinedBremExecutor::operator()(CoreTrackView const& track)
                                     cutoff,
                                     allocate_secondaries,
                                     material,
-                                    selected_element);
+                                    elcomp_id);
 
     auto rng = track.make_rng_engine();
     return interact(rng);
@@ -16,6 +16,7 @@
 #include "celeritas/em/data/AtomicRelaxationData.hh"
 #include "celeritas/phys/CutoffView.hh"
 #include "celeritas/phys/Secondary.hh"
+#include "celeritas/random/Selector.hh"
 #include "celeritas/random/distribution/IsotropicDistribution.hh"
 
 namespace celeritas
@@ -144,8 +145,7 @@ AtomicRelaxation::operator()(Engine& rng)
         if (vacancy_id.get() >= shells.size())
             continue;
 
-        // Sample a transition (TODO: refactor to use Selector but with
-        // "remainder")
+        // Sample a transition
         AtomicRelaxSubshell const& shell = shells[vacancy_id.get()];
         TransitionId const trans_id = this->sample_transition(shell, rng);
 
@@ -197,26 +197,23 @@ AtomicRelaxation::operator()(Engine& rng)
 /*!
  * Sample an atomic transition.
  *
- * TODO: refactor to use a Selector-like algorithm that allows a "remainder"
- * that indicates "not sampled".
+ * The transition is selected in constant time from the subshell's alias
+ * table, whose last entry is the probability that no transition occurs.
  */
 template<class Engine>
 inline CELER_FUNCTION auto
 AtomicRelaxation::sample_transition(AtomicRelaxSubshell const& shell,
                                     Engine& rng) -> TransitionId
 {
-    auto const& transitions = shared_.transitions[shell.transitions];
-
-    real_type accum = -generate_canonical(rng);
-    for (size_type i = 0; i < transitions.size(); ++i)
+    AliasSelector<size_type> select_transition(
+        shared_.alias_tables[shell.select_transition]);
+    size_type const i = select_transition(rng);
+    if (i == shell.transitions.size())
     {
-        accum += transitions[i].probability;
-        if (accum > 0)
-            return TransitionId{i};
+        // No transition was sampled: skip to the next vacancy
+        return {};
     }
-
-    // No transition was sampled: skip to the next vacancy
-    return {};
+    return TransitionId{i};
 }
 
 //---------------------------------------------------------------------------//
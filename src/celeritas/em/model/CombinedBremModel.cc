@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "corecel/cont/Range.hh"
 #include "corecel/math/Quantity.hh"
 #include "celeritas/em/data/CombinedBremData.hh"
 #include "celeritas/em/data/ElectronBremsData.hh"
@@ -21,6 +22,7 @@
 #include "celeritas/global/ActionLauncher.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/grid/ValueGridBuilder.hh"
 #include "celeritas/phys/InteractionApplier.hh"
 
 #include "RelativisticBremModel.hh"
@@ -37,7 +39,8 @@ CombinedBremModel::CombinedBremModel(ActionId id,
                                      MaterialParams const& materials,
                                      SPConstImported data,
                                      ReadData sb_table,
-                                     bool enable_lpm)
+                                     bool enable_lpm,
+                                     bool use_sb_cdf)
     : StaticConcreteAction(
           id,
           "brems-combined",
@@ -49,7 +52,7 @@ CombinedBremModel::CombinedBremModel(ActionId id,
     // Construct SeltzerBergerModel and RelativisticBremModel and save the
     // host data reference
     sb_model_ = std::make_shared<SeltzerBergerModel>(
-        id, particles, materials, data, sb_table);
+        id, particles, materials, data, sb_table, use_sb_cdf);
 
     rb_model_ = std::make_shared<RelativisticBremModel>(
         id, particles, materials, data, enable_lpm);
@@ -83,11 +86,31 @@ auto CombinedBremModel::applicability() const -> SetApplicability
 //---------------------------------------------------------------------------//
 /*!
  * Get the microscopic cross sections for the given particle and material.
+ *
+ * The tabulated Seltzer-Berger and relativistic cross sections for each
+ * element are joined into a single grid spanning both energy regimes, so that
+ * the element is sampled from a single table regardless of the energy.
  */
-auto CombinedBremModel::micro_xs(Applicability) const -> MicroXsBuilders
+auto CombinedBremModel::micro_xs(Applicability applic) const -> MicroXsBuilders
 {
-    // Multiple elements per material not supported for combined brems model
-    return {};
+    MicroXsBuilders sb_builders = sb_model_->micro_xs(applic);
+    MicroXsBuilders rb_builders = rb_model_->micro_xs(applic);
+    CELER_ASSERT(sb_builders.size() == rb_builders.size());
+
+    double const energy
+        = value_as<units::MevEnergy>(detail::seltzer_berger_upper_limit());
+    MicroXsBuilders builders(sb_builders.size());
+    for (auto elcomp_idx : range(builders.size()))
+    {
+        auto const* lower = dynamic_cast<ValueGridLogBuilder const*>(
+            sb_builders[elcomp_idx].get());
+        auto const* upper = dynamic_cast<ValueGridLogBuilder const*>(
+            rb_builders[elcomp_idx].get());
+        CELER_ASSERT(lower && upper);
+        builders[elcomp_idx]
+            = ValueGridLogBuilder::from_joined(*lower, *upper, energy);
+    }
+    return builders;
 }
 
 //---------------------------------------------------------------------------//
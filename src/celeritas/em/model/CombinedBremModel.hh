@@ -48,7 +48,8 @@ class CombinedBremModel final : public Model, public StaticConcreteAction
                       MaterialParams const& materials,
                       SPConstImported data,
                       ReadData load_sb_table,
-                      bool enable_lpm);
+                      bool enable_lpm,
+                      bool use_sb_cdf);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
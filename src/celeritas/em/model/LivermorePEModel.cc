@@ -47,32 +47,35 @@ LivermorePEModel::LivermorePEModel(ActionId id,
     CELER_EXPECT(id);
     CELER_EXPECT(load_data);
 
-    HostVal<LivermorePEData> host_data;
-
-    // Save IDs
-    host_data.ids.electron = particles.find(pdg::electron());
-    host_data.ids.gamma = particles.find(pdg::gamma());
-    CELER_VALIDATE(host_data.ids,
-                   << R"(missing electron and/or gamma particles (required for )"
-                   << this->description() << ")");
-
-    // Save particle properties
-    host_data.inv_electron_mass
-        = 1
-          / value_as<LivermorePERef::Mass>(
-              particles.get(host_data.ids.electron).mass());
-
-    // Load Livermore cross section data
-    detail::LivermoreXsInserter insert_element(&host_data.xs);
-    for (auto el_id : range(ElementId{materials.num_elements()}))
-    {
-        AtomicNumber z = materials.get(el_id).atomic_number();
-        insert_element(load_data(z));
-    }
-    CELER_ASSERT(host_data.xs.elements.size() == materials.num_elements());
-
-    // Move to mirrored data, copying to device
-    data_ = CollectionMirror<LivermorePEData>{std::move(host_data)};
+    // Build data (only once per node if params are shared) and copy to
+    // device
+    data_ = CollectionMirror<LivermorePEData>{[&] {
+        HostVal<LivermorePEData> host_data;
+
+        // Save IDs
+        host_data.ids.electron = particles.find(pdg::electron());
+        host_data.ids.gamma = particles.find(pdg::gamma());
+        CELER_VALIDATE(
+            host_data.ids,
+            << R"(missing electron and/or gamma particles (required for )"
+            << this->description() << ")");
+
+        // Save particle properties
+        host_data.inv_electron_mass
+            = 1
+              / value_as<LivermorePERef::Mass>(
+                  particles.get(host_data.ids.electron).mass());
+
+        // Load Livermore cross section data
+        detail::LivermoreXsInserter insert_element(&host_data.xs);
+        for (auto el_id : range(ElementId{materials.num_elements()}))
+        {
+            AtomicNumber z = materials.get(el_id).atomic_number();
+            insert_element(load_data(z));
+        }
+        CELER_ASSERT(host_data.xs.elements.size() == materials.num_elements());
+        return host_data;
+    }};
     CELER_ENSURE(this->data_);
 }
 
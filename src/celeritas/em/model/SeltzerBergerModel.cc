@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -43,7 +45,8 @@ SeltzerBergerModel::SeltzerBergerModel(ActionId id,
                                        ParticleParams const& particles,
                                        MaterialParams const& materials,
                                        SPConstImported data,
-                                       ReadData load_sb_table)
+                                       ReadData load_sb_table,
+                                       bool use_cdf)
     : StaticConcreteAction(
           id, "brems-sb", "interact by Seltzer-Berger bremsstrahlung")
     , imported_(data,
@@ -57,33 +60,36 @@ SeltzerBergerModel::SeltzerBergerModel(ActionId id,
 
     ScopedMem record_mem("SeltzerBergerModel.construct");
 
-    HostVal<SeltzerBergerData> host_data;
-
-    // Save IDs
-    host_data.ids.electron = particles.find(pdg::electron());
-    host_data.ids.positron = particles.find(pdg::positron());
-    host_data.ids.gamma = particles.find(pdg::gamma());
-    CELER_VALIDATE(host_data.ids,
-                   << "missing particles (required for " << this->description()
-                   << ")");
-
-    // Save particle properties
-    host_data.electron_mass = particles.get(host_data.ids.electron).mass();
-
-    // Load differential cross sections
-    make_builder(&host_data.differential_xs.elements)
-        .reserve(materials.num_elements());
-    for (auto el_id : range(ElementId{materials.num_elements()}))
-    {
-        auto element = materials.get(el_id);
-        this->append_table(load_sb_table(element.atomic_number()),
-                           &host_data.differential_xs);
-    }
-    CELER_ASSERT(host_data.differential_xs.elements.size()
-                 == materials.num_elements());
-
-    // Move to mirrored data, copying to device
-    data_ = CollectionMirror<SeltzerBergerData>{std::move(host_data)};
+    // Build data (only once per node if params are shared) and copy to
+    // device
+    data_ = CollectionMirror<SeltzerBergerData>{[&] {
+        HostVal<SeltzerBergerData> host_data;
+
+        // Save IDs
+        host_data.ids.electron = particles.find(pdg::electron());
+        host_data.ids.positron = particles.find(pdg::positron());
+        host_data.ids.gamma = particles.find(pdg::gamma());
+        CELER_VALIDATE(host_data.ids,
+                       << "missing particles (required for "
+                       << this->description() << ")");
+
+        // Save particle properties
+        host_data.electron_mass = particles.get(host_data.ids.electron).mass();
+
+        // Load differential cross sections
+        make_builder(&host_data.differential_xs.elements)
+            .reserve(materials.num_elements());
+        for (auto el_id : range(ElementId{materials.num_elements()}))
+        {
+            auto element = materials.get(el_id);
+            this->append_table(load_sb_table(element.atomic_number()),
+                               use_cdf,
+                               &host_data.differential_xs);
+        }
+        CELER_ASSERT(host_data.differential_xs.elements.size()
+                     == materials.num_elements());
+        return host_data;
+    }};
 
     CELER_ENSURE(this->data_);
 }
@@ -150,8 +156,13 @@ void SeltzerBergerModel::step(CoreParams const&, CoreStateDevice&) const
  * Here, x = log of scaled incident energy (E / MeV)
  * and y = scaled exiting energy (E_gamma / E_inc)
  * and values are the cross sections.
+ *
+ * If requested, the sampling envelope is also tabulated: for each incident
+ * energy, the largest cross section of the two bounding each y interval, and
+ * the integral over y of that piecewise bound divided by y.
  */
 void SeltzerBergerModel::append_table(ImportSBTable const& imported,
+                                      bool use_cdf,
                                       HostXsTables* tables) const
 {
     auto reals = make_builder(&tables->reals);
@@ -176,8 +187,14 @@ void SeltzerBergerModel::append_table(ImportSBTable const& imported,
     table.grid.values
         = reals.insert_back(imported.value.begin(), imported.value.end());
 
-    // Find the location of the highest cross section at each incident E
-    std::vector<size_type> argmax(table.grid.x.size());
+    // Find the location of the highest cross section at each incident E,
+    // which must be representable as a 16-bit index
+    constexpr size_type max_index = std::numeric_limits<std::uint16_t>::max();
+    CELER_VALIDATE(num_y > 0 && num_y - 1 <= max_index,
+                   << "cannot store the index of the largest of " << num_y
+                   << " reduced photon energy points in a Seltzer-Berger "
+                      "table as a 16-bit integer");
+    std::vector<std::uint16_t> argmax(table.grid.x.size());
     for (size_type i : range(num_x))
     {
         // Get the xs data for the given incident energy coordinate
@@ -185,20 +202,45 @@ void SeltzerBergerModel::append_table(ImportSBTable const& imported,
 
         // Search for the highest cross section value
         size_type max_el = std::max_element(iter, iter + num_y) - iter;
-        CELER_ASSERT(max_el < num_y);
+        CELER_ASSERT(max_el < num_y && max_el <= max_index);
         // Save it!
-        argmax[i] = max_el;
+        argmax[i] = static_cast<std::uint16_t>(max_el);
     }
     table.argmax
         = make_builder(&tables->sizes).insert_back(argmax.begin(), argmax.end());
 
+    if (use_cdf)
+    {
+        // Tabulate the envelope and its integral at each incident E
+        std::vector<real_type> bin_max(num_x * num_y, 0);
+        std::vector<real_type> cdf(num_x * num_y, 0);
+        for (size_type i : range(num_x))
+        {
+            double const* xs = &imported.value[i * num_y];
+            real_type* i_bin_max = &bin_max[i * num_y];
+            real_type* i_cdf = &cdf[i * num_y];
+            for (size_type j : range(num_y - 1))
+            {
+                i_bin_max[j]
+                    = static_cast<real_type>(std::max(xs[j], xs[j + 1]));
+                i_cdf[j + 1] = i_cdf[j]
+                               + i_bin_max[j]
+                                     * std::log(imported.y[j + 1]
+                                                / imported.y[j]);
+            }
+        }
+        table.bin_max = reals.insert_back(bin_max.begin(), bin_max.end());
+        table.cdf = reals.insert_back(cdf.begin(), cdf.end());
+    }
+
     // Add the table
     make_builder(&tables->elements).push_back(table);
 
     CELER_ENSURE(table.grid.x.size() == num_x);
     CELER_ENSURE(table.grid.y.size() == num_y);
     CELER_ENSURE(table.argmax.size() == num_x);
-    CELER_ENSURE(table.grid);
+    CELER_ENSURE(table.has_cdf() == use_cdf);
+    CELER_ENSURE(table.grid && table);
 }
 
 //---------------------------------------------------------------------------//
@@ -45,6 +45,11 @@ class ParticleParams;
  * energy spectra from electrons with kinetic energy 1 keV–10 GeV incident on
  * screened nuclei and orbital electrons of neutral atoms with Z = 1–100", At.
  * Data Nucl. Data Tables 35, 345–418.
+ *
+ * If \c use_cdf is enabled, a piecewise envelope of the exiting energy
+ * distribution and its integral are tabulated for each element and incident
+ * energy so that the photon energy can be sampled by inverting the table
+ * rather than by rejection against the maximum cross section.
  */
 class SeltzerBergerModel final : public Model, public StaticConcreteAction
 {
@@ -63,7 +68,8 @@ class SeltzerBergerModel final : public Model, public StaticConcreteAction
                        ParticleParams const& particles,
                        MaterialParams const& materials,
                        SPConstImported data,
-                       ReadData load_sb_table);
+                       ReadData load_sb_table,
+                       bool use_cdf);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -90,7 +96,9 @@ class SeltzerBergerModel final : public Model, public StaticConcreteAction
     ImportedModelAdapter imported_;
 
     using HostXsTables = HostVal<SeltzerBergerTableData>;
-    void append_table(ImportSBTable const& table, HostXsTables* tables) const;
+    void append_table(ImportSBTable const& table,
+                      bool use_cdf,
+                      HostXsTables* tables) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
+
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/math/Algorithms.hh"
@@ -59,6 +61,10 @@ class UrbanMscHelper
     // The mean free path of the multiple scattering for a given energy [len]
     inline CELER_FUNCTION real_type calc_msc_mfp(Energy energy) const;
 
+    // The mean free path with a precalculated log energy [len]
+    inline CELER_FUNCTION real_type calc_msc_mfp(Energy energy,
+                                                 real_type log_energy) const;
+
     // TODO: the following methods are used only by MscStepLimit
 
     // Calculate the energy corresponding to a given particle range
@@ -115,7 +121,7 @@ UrbanMscHelper::UrbanMscHelper(UrbanMscRef const& shared,
     : shared_(shared)
     , particle_(particle)
     , physics_(physics)
-    , lambda_(this->calc_msc_mfp(particle_.energy()))
+    , lambda_(this->calc_msc_mfp(particle_.energy(), particle_.log_energy()))
 {
     CELER_EXPECT(particle.particle_id() == shared_.ids.electron
                  || particle.particle_id() == shared_.ids.positron);
@@ -126,11 +132,23 @@ UrbanMscHelper::UrbanMscHelper(UrbanMscRef const& shared,
  * Calculate the mean free path of the msc for a given particle energy.
  */
 CELER_FUNCTION real_type UrbanMscHelper::calc_msc_mfp(Energy energy) const
+{
+    CELER_EXPECT(energy > zero_quantity());
+    return this->calc_msc_mfp(energy, std::log(energy.value()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the mean free path of the msc with a precalculated log energy.
+ */
+CELER_FUNCTION real_type
+UrbanMscHelper::calc_msc_mfp(Energy energy, real_type log_energy) const
 {
     CELER_EXPECT(energy > zero_quantity());
     XsCalculator calc_scaled_xs(this->xs(), shared_.reals);
 
-    real_type xsec = calc_scaled_xs(energy) / ipow<2>(energy.value());
+    real_type xsec = calc_scaled_xs(energy, log_energy)
+                     / ipow<2>(energy.value());
     CELER_ENSURE(xsec >= 0 && 1 / xsec > 0);
     return 1 / xsec;
 }
@@ -176,7 +194,7 @@ UrbanMscHelper::calc_end_energy(real_type step) const -> Energy
                                              physics_.eloss_ppid());
         // Assume constant energy loss rate over the step
         real_type dedx = physics_.make_calculator<EnergyLossCalculator>(
-            eloss_gid)(particle_.energy());
+            eloss_gid)(particle_.energy(), particle_.log_energy());
 
         return particle_.energy() - Energy{step * dedx};
     }
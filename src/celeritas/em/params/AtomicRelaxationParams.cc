@@ -31,6 +31,7 @@
 #include "celeritas/phys/CutoffView.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"  // IWYU pragma: keep
+#include "celeritas/random/AliasTable.hh"
 
 namespace celeritas
 {
@@ -164,9 +165,12 @@ void AtomicRelaxationParams::append_element(ImportAtomicRelaxation const& inp,
                                       inp.shells[i].auger.end());
         }
 
-        // Add transition data
+        // Add transition data, with the probability of each transition and
+        // the remaining probability of no transition for the alias table
         std::vector<AtomicRelaxTransition> transitions(
             import_transitions.size());
+        std::vector<double> weights(import_transitions.size() + 1);
+        double remainder = 1;
         for (auto j : range(import_transitions.size()))
         {
             // Find the index in the shells array given the shell designator.
@@ -178,10 +182,18 @@ void AtomicRelaxationParams::append_element(ImportAtomicRelaxation const& inp,
             transitions[j].probability = import_transitions[j].probability;
             transitions[j].energy
                 = units::MevEnergy(import_transitions[j].energy);
+            weights[j] = import_transitions[j].probability;
+            remainder -= weights[j];
         }
+        weights.back() = max(remainder, 0.0);
         shells[i].transitions
             = make_builder(&data->transitions)
                   .insert_back(transitions.begin(), transitions.end());
+
+        auto alias_table = make_alias_table(make_span(weights));
+        shells[i].select_transition
+            = make_builder(&data->alias_tables)
+                  .insert_back(alias_table.begin(), alias_table.end());
     }
     el.shells
         = make_builder(&data->shells).insert_back(shells.begin(), shells.end());
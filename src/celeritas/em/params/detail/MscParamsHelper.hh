@@ -13,13 +13,13 @@
 #include "corecel/data/Collection.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/data/CommonCoulombData.hh"
+#include "celeritas/grid/XsGridData.hh"
 #include "celeritas/io/ImportModel.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 class ParticleParams;
-struct XsGridData;
 
 namespace detail
 {
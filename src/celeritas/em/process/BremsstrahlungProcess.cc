@@ -59,7 +59,8 @@ auto BremsstrahlungProcess::build_models(ActionIdIter start_id) const -> VecMode
                                                          *particles_,
                                                          *materials_,
                                                          imported_.processes(),
-                                                         load_sb_)};
+                                                         load_sb_,
+                                                         options_.use_sb_cdf)};
         case BremsModelSelection::relativistic:
             return {
                 std::make_shared<RelativisticBremModel>(*start_id++,
@@ -76,7 +77,8 @@ auto BremsstrahlungProcess::build_models(ActionIdIter start_id) const -> VecMode
                                                         *materials_,
                                                         imported_.processes(),
                                                         load_sb_,
-                                                        options_.enable_lpm)};
+                                                        options_.enable_lpm,
+                                                        options_.use_sb_cdf)};
             }
             else
             {
@@ -85,7 +87,8 @@ auto BremsstrahlungProcess::build_models(ActionIdIter start_id) const -> VecMode
                                                          *particles_,
                                                          *materials_,
                                                          imported_.processes(),
-                                                         load_sb_),
+                                                         load_sb_,
+                                                         options_.use_sb_cdf),
                     std::make_shared<RelativisticBremModel>(
                         *start_id++,
                         *particles_,
@@ -48,6 +48,8 @@ class BremsstrahlungProcess : public Process
                                 //! energies
         bool use_integral_xs{true};  //!> Use integral method for sampling
                                      //! discrete interaction length
+        bool use_sb_cdf{false};  //!> Sample SB photon energy from a
+                                 //! tabulated envelope
     };
 
   public:
@@ -46,6 +46,8 @@ void validate_input(FieldDriverOptions const& opts)
                    << "invalid max_nsteps " << opts.max_nsteps);
     CELER_VALIDATE(opts.max_substeps > 0,
                    << "invalid max_substeps " << opts.max_substeps);
+    CELER_VALIDATE(opts.uniform_field_tol >= 0 && opts.uniform_field_tol < 1,
+                   << "invalid uniform_field_tol " << opts.uniform_field_tol);
     CELER_ENSURE(opts);
 }
 
@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/field/HelixDormandPrinceStepper.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+
+#include "DormandPrinceStepper.hh"
+#include "HelixStepper.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Step analytically where the field is nearly uniform, else integrate.
+ *
+ * Each step is first taken along a helix in the field at the starting point
+ * (see \c HelixStepper). If the field at the middle and end of the helix
+ * differs from the starting field by no more than the relative tolerance, the
+ * helix is accepted with an error estimate based on the change in curvature.
+ * Otherwise the step is integrated with the \c DormandPrinceStepper. This
+ * costs three field evaluations per step in nearly uniform regions (e.g.,
+ * inside a solenoid) instead of seven, at the expense of three additional
+ * evaluations when the fallback is needed. A nonpositive tolerance disables
+ * the helix entirely.
+ */
+template<class EquationT>
+class HelixDormandPrinceStepper
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using result_type = FieldStepperResult;
+    //!@}
+
+  public:
+    //! Construct with the equation of motion and relative field tolerance
+    CELER_FUNCTION HelixDormandPrinceStepper(EquationT&& eq, real_type tol)
+        : calc_rhs_(::celeritas::forward<EquationT>(eq)), tolerance_(tol)
+    {
+    }
+
+    // Take a helical step if the field is nearly uniform along it
+    inline CELER_FUNCTION result_type
+    operator()(real_type step, OdeState const& beg_state) const;
+
+  private:
+    // Evaluate the equation of the motion
+    EquationT calc_rhs_;
+    // Maximum relative change in the field over a helical step
+    real_type tolerance_;
+};
+
+//---------------------------------------------------------------------------//
+// DEDUCTION GUIDES
+//---------------------------------------------------------------------------//
+template<class EquationT>
+CELER_FUNCTION HelixDormandPrinceStepper(EquationT&&, real_type)
+    -> HelixDormandPrinceStepper<EquationT>;
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Take a helical step if the field is nearly uniform along it.
+ *
+ * The error of the helix relative to the true trajectory is estimated from
+ * the turning angle \f$\theta\f$ over the step and the relative change
+ * \f$\delta\f$ in the field: the direction error is about \f$\theta\delta\f$
+ * and the position error about \f$s\theta\delta/2\f$. Since the direction of
+ * the error is unknown, like the helix tolerance it is added to every
+ * component.
+ */
+template<class E>
+CELER_FUNCTION auto
+HelixDormandPrinceStepper<E>::operator()(real_type step,
+                                         OdeState const& beg_state) const
+    -> result_type
+{
+    if (tolerance_ > 0)
+    {
+        Real3 const field = calc_rhs_.calc_field(beg_state.pos);
+        HelixStepper<E const&> helix_step{calc_rhs_};
+        result_type result = helix_step(step, beg_state, field);
+
+        // Find the largest change in the field along the helix
+        real_type delta = celeritas::max(
+            distance(calc_rhs_.calc_field(result.mid_state.pos), field),
+            distance(calc_rhs_.calc_field(result.end_state.pos), field));
+        real_type const field_strength = norm(field);
+        if (delta <= tolerance_ * field_strength)
+        {
+            if (delta > 0)
+            {
+                // Add the error due to the change in curvature
+                delta /= field_strength;
+                real_type const momentum = norm(beg_state.mom);
+                real_type const angle = std::fabs(calc_rhs_.coefficient())
+                                        * field_strength / momentum * step;
+                real_type const pos_err = real_type(0.5) * step * angle * delta;
+                real_type const mom_err = momentum * angle * delta;
+                for (int i = 0; i < 3; ++i)
+                {
+                    result.err_state.pos[i] += pos_err;
+                    result.err_state.mom[i] += mom_err;
+                }
+            }
+            return result;
+        }
+    }
+
+    DormandPrinceStepper<E const&> integrate{calc_rhs_};
+    return integrate(step, beg_state);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
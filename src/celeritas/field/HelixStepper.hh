@@ -0,0 +1,181 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/field/HelixStepper.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayOperators.hh"
+#include "corecel/math/ArrayUtils.hh"
+
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Analytically step along a helix in a locally uniform magnetic field.
+ *
+ * This generalizes \c ZHelixStepper to a field along an arbitrary axis and a
+ * helix with an arbitrary center. The field is evaluated once at the
+ * starting position and assumed constant over the step, so the result is
+ * exact only for a uniform field. The equation of motion must provide the
+ * field and the Lorentz coefficient, as \c MagFieldEquation does.
+ *
+ * With the unit field direction \f$\hat{b}\f$, the direction
+ * \f$\hat{d} = \hat{d}_\parallel + \hat{d}_\perp\f$ rotates about
+ * \f$\hat{b}\f$ by the angle \f$\theta = k s\f$ after a path length \em s,
+ * where \f$ k = -(q/p)|B| \f$:
+ * \f[
+   \hat{d}(s) = \hat{d}_\parallel + \hat{d}_\perp \cos\theta
+                + (\hat{b} \times \hat{d}_\perp) \sin\theta
+   \f]
+ * and the position is its integral:
+ * \f[
+   \vec{x}(s) = \vec{x}_0 + s \hat{d}_\parallel
+                + \hat{d}_\perp \frac{\sin\theta}{k}
+                + (\hat{b} \times \hat{d}_\perp) \frac{1 - \cos\theta}{k}
+   \,.
+   \f]
+ */
+template<class EquationT>
+class HelixStepper
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using result_type = FieldStepperResult;
+    //!@}
+
+  public:
+    //! Construct with the equation of motion
+    explicit CELER_FUNCTION HelixStepper(EquationT&& eq)
+        : calc_rhs_(::celeritas::forward<EquationT>(eq))
+    {
+    }
+
+    // Step along a helix using the field at the starting point
+    inline CELER_FUNCTION result_type operator()(real_type step,
+                                                 OdeState const& beg_state) const;
+
+    // Step along a helix in the given uniform field
+    inline CELER_FUNCTION result_type operator()(real_type step,
+                                                 OdeState const& beg_state,
+                                                 Real3 const& field) const;
+
+    //! Access the equation of motion
+    CELER_FUNCTION EquationT const& equation() const { return calc_rhs_; }
+
+  private:
+    //// DATA ////
+
+    // Evaluate the equation of the motion
+    EquationT calc_rhs_;
+
+    //// COMMON PROPERTIES ////
+
+    static CELER_CONSTEXPR_FUNCTION real_type tolerance()
+    {
+        if constexpr (std::is_same_v<real_type, double>)
+            return 1e-10;
+        else if constexpr (std::is_same_v<real_type, float>)
+            return 1e-5f;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// DEDUCTION GUIDES
+//---------------------------------------------------------------------------//
+template<class EquationT>
+CELER_FUNCTION HelixStepper(EquationT&&) -> HelixStepper<EquationT>;
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Step along a helix using the field at the starting point.
+ */
+template<class E>
+CELER_FUNCTION auto
+HelixStepper<E>::operator()(real_type step,
+                            OdeState const& beg_state) const -> result_type
+{
+    return (*this)(step, beg_state, calc_rhs_.calc_field(beg_state.pos));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step along a helix in the given uniform field.
+ *
+ * The states at the middle and end of the step are exact, but a small error
+ * is assigned for numerical treatments.
+ */
+template<class E>
+CELER_FUNCTION auto
+HelixStepper<E>::operator()(real_type step,
+                            OdeState const& beg_state,
+                            Real3 const& field) const -> result_type
+{
+    real_type const momentum = norm(beg_state.mom);
+    CELER_EXPECT(momentum > 0);
+    Real3 const dir = (1 / momentum) * beg_state.mom;
+
+    // Decompose the direction along and perpendicular to the field
+    real_type const field_strength = norm(field);
+    Real3 axis{0, 0, 1};
+    real_type curvature = 0;
+    if (field_strength > 0)
+    {
+        axis = (1 / field_strength) * field;
+        curvature = -calc_rhs_.coefficient() * field_strength / momentum;
+    }
+    Real3 const dir_par = dot_product(dir, axis) * axis;
+    Real3 const dir_perp = dir - dir_par;
+    Real3 const dir_cross = cross_product(axis, dir_perp);
+
+    auto move = [&](real_type s) {
+        // Straight-line limit of the coefficients for zero curvature
+        real_type sin_term = s;
+        real_type cos_term = 0;
+        real_type sin_theta = 0;
+        real_type cos_theta = 1;
+        if (curvature != 0)
+        {
+            real_type theta = curvature * s;
+            sin_theta = std::sin(theta);
+            cos_theta = std::cos(theta);
+            sin_term = sin_theta / curvature;
+            cos_term = 2 * ipow<2>(std::sin(theta / 2)) / curvature;
+        }
+
+        OdeState result;
+        result.pos = beg_state.pos;
+        axpy(s, dir_par, &result.pos);
+        axpy(sin_term, dir_perp, &result.pos);
+        axpy(cos_term, dir_cross, &result.pos);
+
+        result.mom = dir_par;
+        axpy(cos_theta, dir_perp, &result.mom);
+        axpy(sin_theta, dir_cross, &result.mom);
+        result.mom *= momentum;
+        return result;
+    };
+
+    result_type result;
+    result.mid_state = move(real_type(0.5) * step);
+    result.end_state = move(step);
+    result.err_state.pos.fill(HelixStepper::tolerance());
+    result.err_state.mom.fill(HelixStepper::tolerance());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -62,6 +62,15 @@ class MagFieldEquation
     // Evaluate the right hand side of the field equation
     inline CELER_FUNCTION OdeState operator()(OdeState const& y) const;
 
+    //! Evaluate the magnetic field at a position
+    CELER_FUNCTION Real3 calc_field(Real3 const& pos) const
+    {
+        return calc_field_(pos);
+    }
+
+    //! Lorentz coefficient (charge) in 1/OdeState::MomentumUnits
+    CELER_FUNCTION real_type coefficient() const { return coeffi_; }
+
   private:
     // Field evaluator
     Field_t calc_field_;
@@ -12,7 +12,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/grid/FindInterp.hh"
-#include "corecel/grid/UniformGrid.hh"
+#include "corecel/grid/UniformGridData.hh"
 #include "corecel/math/Algorithms.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/Units.hh"
@@ -46,8 +46,9 @@ class RZMapField
     // Shared constant field map
     FieldParamsRef const& params_;
 
-    UniformGrid const grid_r_;
-    UniformGrid const grid_z_;
+    // Find the cell index and fractional position in it
+    static CELER_FUNCTION FindInterp<real_type>
+    find_cell(UniformGridData const& grid, real_type value);
 };
 
 //---------------------------------------------------------------------------//
@@ -57,12 +58,7 @@ class RZMapField
  * Construct with the shared magnetic field map data.
  */
 CELER_FUNCTION
-RZMapField::RZMapField(FieldParamsRef const& params)
-    : params_(params)
-    , grid_r_(params_.grids.data_r)
-    , grid_z_(params_.grids.data_z)
-{
-}
+RZMapField::RZMapField(FieldParamsRef const& params) : params_(params) {}
 
 //---------------------------------------------------------------------------//
 /*!
@@ -70,7 +66,8 @@ RZMapField::RZMapField(FieldParamsRef const& params)
  *
  * This does a 2-D interpolation on the input grid and reconstructs the
  * magnetic field vector from the stored R and Z components of the field. The
- * result is in the native Celeritas unit system.
+ * result is in the native Celeritas unit system. The field values and their
+ * differences across the enclosing cell are loaded together.
  */
 CELER_FUNCTION auto RZMapField::operator()(Real3 const& pos) const -> Real3
 {
@@ -84,27 +81,46 @@ CELER_FUNCTION auto RZMapField::operator()(Real3 const& pos) const -> Real3
         return value;
 
     // Find interpolation points for given r and z
-    FindInterp<real_type> interp_r = find_interp<UniformGrid>(grid_r_, r);
-    FindInterp<real_type> interp_z = find_interp<UniformGrid>(grid_z_, pos[2]);
+    FindInterp<real_type> interp_r = find_cell(params_.grids.data_r, r);
+    FindInterp<real_type> interp_z = find_cell(params_.grids.data_z, pos[2]);
 
-    size_type ir = interp_r.index;
-    size_type iz = interp_z.index;
+    FieldMapCell const& cell
+        = params_.fieldmap[params_.id(interp_z.index, interp_r.index)];
 
     // z component
-    real_type low = params_.fieldmap[params_.id(iz, ir)].value_z;
-    real_type high = params_.fieldmap[params_.id(iz + 1, ir)].value_z;
-    value[2] = low + (high - low) * interp_z.fraction;
+    value[2] = cell.value_z + cell.delta_z * interp_z.fraction;
 
     // x and y components
-    low = params_.fieldmap[params_.id(iz, ir)].value_r;
-    high = params_.fieldmap[params_.id(iz, ir + 1)].value_r;
-    real_type tmp = (r != 0) ? (low + (high - low) * interp_r.fraction) / r
-                             : low;
+    real_type tmp = cell.value_r + cell.delta_r * interp_r.fraction;
+    if (r != 0)
+    {
+        tmp /= r;
+    }
     value[0] = tmp * pos[0];
     value[1] = tmp * pos[1];
 
     return value;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the cell index and fractional position in it.
+ *
+ * This is equivalent to \c find_interp on a \c UniformGrid but with a single
+ * division. A value on the upper edge of the grid is placed at the end of the
+ * last cell.
+ */
+CELER_FUNCTION FindInterp<real_type>
+RZMapField::find_cell(UniformGridData const& grid, real_type value)
+{
+    CELER_EXPECT(value >= grid.front && value <= grid.back);
+
+    real_type t = (value - grid.front) / grid.delta;
+    FindInterp<real_type> result;
+    result.index = celeritas::min(static_cast<size_type>(t), grid.size - 2);
+    result.fraction = t - static_cast<real_type>(result.index);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
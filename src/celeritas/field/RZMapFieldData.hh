@@ -28,12 +28,19 @@ struct FieldMapGridData
 
 //---------------------------------------------------------------------------//
 /*!
- * FieldMap element
+ * Interpolation data for a single cell of the field map.
+ *
+ * Each cell stores the field components at its lower corner along with their
+ * differences to the next grid point, so that evaluating the field requires a
+ * single contiguous load. The Z component is interpolated along Z and the R
+ * component along R.
  */
-struct FieldMapElement
+struct alignas(4 * sizeof(real_type)) FieldMapCell
 {
-    real_type value_z;
-    real_type value_r;
+    real_type value_z;  //!< Z component at the lower corner
+    real_type delta_z;  //!< Change in Z component to the next Z point
+    real_type value_r;  //!< R component at the lower corner
+    real_type delta_r;  //!< Change in R component to the next R point
 };
 
 //---------------------------------------------------------------------------//
@@ -54,7 +61,8 @@ struct RZMapFieldParamsData
 
     template<class T>
     using ElementItems = Collection<T, W, M, ElementId>;
-    ElementItems<FieldMapElement> fieldmap;
+    //! Cells with dimensions [Z - 1][R - 1]
+    ElementItems<FieldMapCell> fieldmap;
 
     //! Check whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
@@ -73,7 +81,8 @@ struct RZMapFieldParamsData
     inline CELER_FUNCTION ElementId id(size_type idx_z, size_type idx_r) const
     {
         CELER_EXPECT(grids.data_r);
-        return ElementId(idx_z * grids.data_r.size + idx_r);
+        CELER_EXPECT(idx_r + 1 < grids.data_r.size);
+        return ElementId(idx_z * (grids.data_r.size - 1) + idx_r);
     }
 
     //! Assign from another set of data
@@ -63,15 +63,26 @@ RZMapFieldParams::RZMapFieldParams(RZMapFieldInput const& inp)
         host.grids.data_z = UniformGridData::from_bounds(
             inp.min_z, inp.max_z, inp.num_grid_z);
 
+        // Input is indexed as [Z][R]
+        auto input_idx = [num_r = inp.num_grid_r](size_type iz, size_type ir) {
+            return iz * num_r + ir;
+        };
+
         auto fieldmap = make_builder(&host.fieldmap);
-        fieldmap.reserve(inp.field_z.size());
-        for (auto i : range(inp.field_z.size()))
+        fieldmap.reserve((inp.num_grid_z - 1) * (inp.num_grid_r - 1));
+        for (auto iz : range(inp.num_grid_z - 1))
         {
-            // Save field vector
-            FieldMapElement el;
-            el.value_z = inp.field_z[i];
-            el.value_r = inp.field_r[i];
-            fieldmap.push_back(el);
+            for (auto ir : range(inp.num_grid_r - 1))
+            {
+                // Save field and its change across the cell
+                auto i = input_idx(iz, ir);
+                FieldMapCell cell;
+                cell.value_z = inp.field_z[i];
+                cell.delta_z = inp.field_z[input_idx(iz + 1, ir)] - cell.value_z;
+                cell.value_r = inp.field_r[i];
+                cell.delta_r = inp.field_r[input_idx(iz, ir + 1)] - cell.value_r;
+                fieldmap.push_back(cell);
+            }
         }
 
         host.options = inp.driver_options;
@@ -158,6 +158,9 @@ class CoreState final : public CoreStateInterface
     // Access action offsets for computation (native memory space)
     inline auto& native_action_thread_offsets();
 
+    //! Access temporary storage for sorting on host
+    detail::TrackSortBuffers& sort_buffers() { return sort_buffers_; }
+
   private:
     // State data
     CollectionStateStore<CoreStateData, M> states_;
@@ -177,6 +180,9 @@ class CoreState final : public CoreStateInterface
     // Indices of first thread assigned to a given action
     detail::CoreStateThreadOffsets<M> offsets_;
 
+    // Reusable storage for sorting track slots on host
+    detail::TrackSortBuffers sort_buffers_;
+
     // Whether no primaries should be generated
     bool warming_up_{false};
 };
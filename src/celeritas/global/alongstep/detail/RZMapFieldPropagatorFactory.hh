@@ -7,7 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "celeritas/field/DormandPrinceStepper.hh"
+#include "celeritas/field/HelixDormandPrinceStepper.hh"
+#include "celeritas/field/MagFieldEquation.hh"
 #include "celeritas/field/MakeMagFieldPropagator.hh"
 #include "celeritas/field/RZMapField.hh"  // IWYU pragma: associated
 #include "celeritas/field/RZMapFieldData.hh"  // IWYU pragma: associated
@@ -19,15 +20,23 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Propagate a track in an RZ map magnetic field.
+ *
+ * Where the field is uniform to within the \c uniform_field_tol driver option,
+ * steps are taken along an analytic helix rather than integrated.
  */
 struct RZMapFieldPropagatorFactory
 {
     CELER_FUNCTION decltype(auto) operator()(CoreTrackView const& track) const
     {
-        return make_mag_field_propagator<DormandPrinceStepper>(
-            RZMapField{field},
+        using Equation_t = MagFieldEquation<RZMapField>;
+
+        auto particle = track.make_particle_view();
+        return make_field_propagator(
+            HelixDormandPrinceStepper{
+                Equation_t{RZMapField{field}, particle.charge()},
+                field.options.uniform_field_tol},
             field.options,
-            track.make_particle_view(),
+            particle,
             track.make_geo_view());
     }
 
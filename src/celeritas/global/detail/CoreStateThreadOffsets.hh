@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+
 #include "corecel/Types.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
@@ -17,6 +19,16 @@ namespace celeritas
 {
 namespace detail
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Temporary storage reused by each host counting sort of the track slots.
+ */
+struct TrackSortBuffers
+{
+    std::vector<size_type> counts;  //!< Histogram and offsets of each chunk
+    std::vector<TrackSlotId::size_type> slots;  //!< Sorted track slots
+};
+
 //---------------------------------------------------------------------------//
 template<MemSpace M>
 class CoreStateThreadOffsets;
@@ -13,6 +13,7 @@
 #include "corecel/grid/Interpolator.hh"
 #include "corecel/grid/UniformGrid.hh"
 #include "corecel/math/Quantity.hh"
+#include "corecel/math/SoftEqual.hh"
 
 #include "XsGridData.hh"
 
@@ -50,6 +51,10 @@ class RangeCalculator
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate from the energy and its precalculated logarithm
+    inline CELER_FUNCTION real_type operator()(Energy energy,
+                                               real_type log_energy) const;
+
   private:
     XsGridData const& data_;
     Values const& reals_;
@@ -80,8 +85,19 @@ RangeCalculator::RangeCalculator(XsGridData const& grid, Values const& values)
 CELER_FUNCTION real_type RangeCalculator::operator()(Energy energy) const
 {
     CELER_ASSERT(energy > zero_quantity());
+    return (*this)(energy, std::log(energy.value()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the range using a precalculated log energy.
+ */
+CELER_FUNCTION real_type RangeCalculator::operator()(Energy energy,
+                                                     real_type loge) const
+{
+    CELER_ASSERT(energy > zero_quantity());
+    CELER_EXPECT(soft_equal(std::log(energy.value()), loge));
     UniformGrid loge_grid(data_.log_energy);
-    real_type const loge = std::log(energy.value());
 
     if (loge <= loge_grid.front())
     {
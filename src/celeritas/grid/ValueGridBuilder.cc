@@ -16,6 +16,7 @@
 #include "corecel/grid/UniformGrid.hh"
 #include "corecel/grid/UniformGridData.hh"
 #include "corecel/grid/VectorUtils.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/math/SoftEqual.hh"
 
 #include "ValueGridInserter.hh"
@@ -219,6 +220,48 @@ auto ValueGridLogBuilder::from_range(SpanConstDbl energy,
     return ValueGridLogBuilder::from_geant(energy, value);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by joining two grids at the given energy.
+ *
+ * The result spans from the lower bound of the \c lower grid to the upper
+ * bound of the \c upper grid, with values from \c lower below the joining
+ * energy and from \c upper at and above it. It is uniform in log(E) with a
+ * spacing no larger than the finer of the two grids; when both grids have the
+ * same spacing and meet at a grid point, the original values are reproduced
+ * up to roundoff.
+ */
+auto ValueGridLogBuilder::from_joined(ValueGridLogBuilder const& lower,
+                                      ValueGridLogBuilder const& upper,
+                                      double energy) -> UPLogBuilder
+{
+    CELER_EXPECT(energy > 0);
+    double const log_energy = std::log(energy);
+    CELER_EXPECT(lower.log_emin_ < log_energy);
+    CELER_EXPECT(log_energy < upper.log_emax_);
+
+    double const log_emin = lower.log_emin_;
+    double const log_emax = upper.log_emax_;
+    double const delta = std::min(lower.log_delta(), upper.log_delta());
+
+    // Number of intervals, allowing for roundoff in the source spacing
+    auto const num_intervals = static_cast<size_type>(
+        std::ceil((log_emax - log_emin) / delta - 1e-6));
+
+    VecDbl value(num_intervals + 1);
+    double const log_delta = (log_emax - log_emin) / num_intervals;
+    for (auto i : range(value.size()))
+    {
+        double const log_e = log_emin + i * log_delta;
+        bool const is_lower = log_e < log_energy
+                              && !soft_equal(log_e, log_energy);
+        value[i] = is_lower ? lower.interpolate(log_e)
+                            : upper.interpolate(log_e);
+    }
+    return std::make_unique<ValueGridLogBuilder>(
+        std::exp(log_emin), std::exp(log_emax), std::move(value));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from raw data.
@@ -253,6 +296,33 @@ auto ValueGridLogBuilder::value() const -> SpanConstDbl
     return make_span(value_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Spacing between grid points in log(E).
+ */
+double ValueGridLogBuilder::log_delta() const
+{
+    return (log_emax_ - log_emin_) / (value_.size() - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate linearly in energy, clamping to the grid bounds.
+ *
+ * This matches the interpolation used by \c XsCalculator.
+ */
+double ValueGridLogBuilder::interpolate(double log_energy) const
+{
+    double const log_e = clamp(log_energy, log_emin_, log_emax_);
+    auto const i = std::min(
+        static_cast<size_type>((log_e - log_emin_) / this->log_delta()),
+        static_cast<size_type>(value_.size() - 2));
+    double const lower = std::exp(log_emin_ + i * this->log_delta());
+    double const upper = std::exp(log_emin_ + (i + 1) * this->log_delta());
+    double const t = (std::exp(log_e) - lower) / (upper - lower);
+    return (1 - t) * value_[i] + t * value_[i + 1];
+}
+
 //---------------------------------------------------------------------------//
 // ON-THE-FLY
 //---------------------------------------------------------------------------//
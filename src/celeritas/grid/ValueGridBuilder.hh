@@ -15,10 +15,11 @@
 #include "corecel/data/Collection.hh"
 #include "celeritas/Types.hh"
 
+#include "XsGridData.hh"
+
 namespace celeritas
 {
 class ValueGridInserter;
-struct XsGridData;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -32,7 +33,7 @@ class ValueGridBuilder
   public:
     //!@{
     //! \name Type aliases
-    using ValueGridId = ItemId<struct XsGridData>;
+    using ValueGridId = ItemId<XsGridData>;
     //!@}
 
   public:
@@ -119,6 +120,11 @@ class ValueGridLogBuilder : public ValueGridBuilder
     // Construct from range
     static UPLogBuilder from_range(SpanConstDbl energy, SpanConstDbl range);
 
+    // Construct by joining two grids at the given energy
+    static UPLogBuilder from_joined(ValueGridLogBuilder const& lower,
+                                    ValueGridLogBuilder const& upper,
+                                    double energy);
+
     // Construct
     ValueGridLogBuilder(double emin, double emax, VecDbl value);
 
@@ -132,6 +138,12 @@ class ValueGridLogBuilder : public ValueGridBuilder
     double log_emin_;
     double log_emax_;
     VecDbl value_;
+
+    // Spacing between grid points in log(E)
+    double log_delta() const;
+
+    // Interpolate linearly in energy, clamping to the grid bounds
+    double interpolate(double log_energy) const;
 };
 
 //---------------------------------------------------------------------------//
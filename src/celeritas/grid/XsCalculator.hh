@@ -12,6 +12,7 @@
 #include "corecel/grid/Interpolator.hh"
 #include "corecel/grid/UniformGrid.hh"
 #include "corecel/math/Quantity.hh"
+#include "corecel/math/SoftEqual.hh"
 
 #include "XsGridData.hh"
 
@@ -30,29 +31,38 @@ namespace celeritas
  * piecewise change in the interpolation instead of storing the cross section
  * scaled by the energy.
  *
+ * The tabulated values are stored as \c T but are always interpolated as
+ * \c real_type : \c XsCalculator uses full-precision storage, and
+ * \c CompactXsCalculator reads single-precision tables.
+ *
  * \code
     XsCalculator calc_xs(xs_grid, xs_params.reals);
     real_type xs = calc_xs(particle);
    \endcode
  */
-class XsCalculator
+template<class T>
+class XsGridCalculator
 {
   public:
     //!@{
     //! \name Type aliases
-    using Energy = Quantity<XsGridData::EnergyUnits>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Grid = XsGridRecord<T>;
+    using Energy = Quantity<typename Grid::EnergyUnits>;
+    using Values = Collection<T, Ownership::const_reference, MemSpace::native>;
     //!@}
 
   public:
     // Construct from state-independent data
     inline CELER_FUNCTION
-    XsCalculator(XsGridData const& grid, Values const& values);
+    XsGridCalculator(Grid const& grid, Values const& values);
 
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate from the energy and its precalculated logarithm
+    inline CELER_FUNCTION real_type operator()(Energy energy,
+                                               real_type log_energy) const;
+
     // Get the cross section at the given index
     inline CELER_FUNCTION real_type operator[](size_type index) const;
 
@@ -69,21 +79,31 @@ class XsCalculator
     }
 
   private:
-    XsGridData const& data_;
+    Grid const& data_;
     Values const& reals_;
     UniformGrid loge_grid_;
 
     CELER_FORCEINLINE_FUNCTION real_type get(size_type index) const;
 };
 
+//---------------------------------------------------------------------------//
+// TYPE ALIASES
+//---------------------------------------------------------------------------//
+
+//! Interpolate cross sections stored at full precision
+using XsCalculator = XsGridCalculator<real_type>;
+//! Interpolate cross sections stored at single precision
+using CompactXsCalculator = XsGridCalculator<float>;
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
 /*!
  * Construct from cross section data.
  */
+template<class T>
 CELER_FUNCTION
-XsCalculator::XsCalculator(XsGridData const& grid, Values const& values)
+XsGridCalculator<T>::XsGridCalculator(Grid const& grid, Values const& values)
     : data_(grid), reals_(values), loge_grid_(data_.log_energy)
 {
     CELER_EXPECT(data_);
@@ -93,14 +113,27 @@ XsCalculator::XsCalculator(XsGridData const& grid, Values const& values)
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the cross section.
- *
- * If needed, we can add a "log(energy/MeV)" accessor if we constantly reuse
- * that value and don't want to repeat the `std::log` operation.
  */
-CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
+template<class T>
+CELER_FUNCTION real_type XsGridCalculator<T>::operator()(Energy energy) const
 {
-    real_type const loge = std::log(energy.value());
+    return (*this)(energy, std::log(energy.value()));
+}
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the cross section using a precalculated log energy.
+ *
+ * The log energy must be the natural log of the energy in the grid's units
+ * (e.g., from \c ParticleTrackView::log_energy). Reusing it avoids a
+ * \c std::log call each time a grid is evaluated at the same energy.
+ */
+template<class T>
+CELER_FUNCTION real_type XsGridCalculator<T>::operator()(Energy energy,
+                                                         real_type loge) const
+{
+    CELER_EXPECT(energy == zero_quantity()
+                 || soft_equal(std::log(energy.value()), loge));
     // Snap out-of-bounds values to closest grid points
     size_type lower_idx;
     real_type result;
@@ -147,7 +180,8 @@ CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
 /*!
  * Get the cross section at the given index.
  */
-CELER_FUNCTION real_type XsCalculator::operator[](size_type index) const
+template<class T>
+CELER_FUNCTION real_type XsGridCalculator<T>::operator[](size_type index) const
 {
     real_type energy = std::exp(loge_grid_[index]);
     real_type result = this->get(index);
@@ -163,10 +197,11 @@ CELER_FUNCTION real_type XsCalculator::operator[](size_type index) const
 /*!
  * Get the raw cross section data at a particular index.
  */
-CELER_FUNCTION real_type XsCalculator::get(size_type index) const
+template<class T>
+CELER_FUNCTION real_type XsGridCalculator<T>::get(size_type index) const
 {
     CELER_EXPECT(index < data_.value.size());
-    return reals_[data_.value[index]];
+    return static_cast<real_type>(reals_[data_.value[index]]);
 }
 
 //---------------------------------------------------------------------------//
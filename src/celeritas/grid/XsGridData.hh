@@ -24,9 +24,14 @@ namespace celeritas
  *
  * Interpolation is linear-linear after transforming to log-E space and before
  * scaling the value by E (if the grid point is above prime_index).
+ *
+ * The values are stored as \c T , which may be a lower precision than
+ * \c real_type to reduce the memory footprint of large tables.
  */
-struct XsGridData
+template<class T>
+struct XsGridRecord
 {
+    using value_type = T;
     using EnergyUnits = units::Mev;
     using XsUnits = units::Native;
 
@@ -38,7 +43,7 @@ struct XsGridData
 
     UniformGridData log_energy;
     size_type prime_index{no_scaling()};
-    ItemRange<real_type> value;
+    ItemRange<T> value;
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -49,5 +54,8 @@ struct XsGridData
     }
 };
 
+//! Grid with values stored at full precision
+using XsGridData = XsGridRecord<real_type>;
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -0,0 +1,216 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/MappedEventReader.cc
+//---------------------------------------------------------------------------//
+#include "MappedEventReader.hh"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define CELER_MAPPED_EVENTS_MMAP 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    define CELER_MAPPED_EVENTS_MMAP 0
+#    include <fstream>
+#    include <iterator>
+#endif
+#include <cstring>
+#include <limits>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "detail/MappedEventFormat.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Release the file mapping.
+ */
+void unmap(char const* data, std::size_t size)
+{
+#if CELER_MAPPED_EVENTS_MMAP
+    if (data)
+    {
+        ::munmap(const_cast<char*>(data), size);
+    }
+#else
+    CELER_DISCARD(data);
+    CELER_DISCARD(size);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map the file and validate it against the particle data.
+ */
+MappedEventReader::MappedEventReader(std::string const& filename,
+                                     SPConstParticles const& params)
+{
+    CELER_EXPECT(params);
+
+#if CELER_MAPPED_EVENTS_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    CELER_VALIDATE(fd >= 0,
+                   << "failed to open primary file at '" << filename << "'");
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        size_ = static_cast<std::size_t>(st.st_size);
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED)
+        {
+            data_ = static_cast<char const*>(addr);
+        }
+    }
+    ::close(fd);
+    CELER_VALIDATE(data_,
+                   << "failed to memory-map primary file at '" << filename
+                   << "'");
+#else
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open primary file at '" << filename << "'");
+    buffer_.assign(std::istreambuf_iterator<char>(infile),
+                   std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+
+    try
+    {
+        this->validate(filename, *params);
+    }
+    catch (...)
+    {
+        unmap(data_, size_);
+        throw;
+    }
+
+    CELER_LOG(info) << "Mapped " << num_events_ << " events with "
+                    << offsets_[num_events_] << " primaries from "
+                    << filename;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap the file.
+ */
+MappedEventReader::~MappedEventReader()
+{
+    unmap(data_, size_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the primaries of the next event.
+ *
+ * An empty vector is returned after the last event.
+ */
+auto MappedEventReader::operator()() -> result_type
+{
+    if (next_event_.get() >= num_events_)
+    {
+        return {};
+    }
+    auto primaries = (*this)(next_event_++);
+    return {primaries.begin(), primaries.end()};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Check the file contents and set up views into the data.
+ */
+void MappedEventReader::validate(std::string const& filename,
+                                 ParticleParams const& params)
+{
+    // Check the header
+    detail::MappedEventHeader header;
+    CELER_VALIDATE(size_ >= sizeof(header),
+                   << "primary file at '" << filename << "' is truncated");
+    std::memcpy(&header, data_, sizeof(header));
+    CELER_VALIDATE(std::memcmp(header.magic,
+                               detail::mapped_event_magic,
+                               sizeof(header.magic))
+                       == 0,
+                   << "'" << filename
+                   << "' is not a mapped primary file (or was not closed)");
+    CELER_VALIDATE(header.primary_size == sizeof(Primary)
+                       && header.real_size == sizeof(real_type)
+                       && header.unit_system
+                              == static_cast<std::uint32_t>(
+                                  UnitSystem::native),
+                   << "primary file at '" << filename
+                   << "' was written with an incompatible build "
+                      "configuration (real type or unit system)");
+
+    CELER_VALIDATE(header.num_events < std::numeric_limits<size_type>::max(),
+                   << "primary file at '" << filename << "' has too many "
+                   << "events (" << header.num_events << ")");
+    CELER_VALIDATE(header.index_offset >= sizeof(header)
+                       && header.index_offset <= size_
+                       && header.index_offset % alignof(std::uint64_t) == 0,
+                   << "primary file at '" << filename
+                   << "' has an invalid event index location");
+
+    std::size_t const index_size = (header.num_events + 1)
+                                   * sizeof(std::uint64_t);
+    std::size_t const table_size = header.num_particles
+                                   * sizeof(std::int32_t);
+    CELER_VALIDATE(header.index_offset + index_size + table_size == size_,
+                   << "primary file at '" << filename << "' is truncated");
+
+    primaries_ = reinterpret_cast<Primary const*>(data_ + sizeof(header));
+    offsets_ = reinterpret_cast<std::uint64_t const*>(data_
+                                                      + header.index_offset);
+    num_events_ = static_cast<size_type>(header.num_events);
+
+    // Event offsets must be sorted and stay inside the primary data, which
+    // is followed by less than one word of padding
+    std::uint64_t const max_primaries = (header.index_offset - sizeof(header))
+                                        / sizeof(Primary);
+    CELER_VALIDATE(offsets_[0] == 0,
+                   << "primary file at '" << filename
+                   << "' has an inconsistent event index");
+    for (auto i : range(num_events_))
+    {
+        CELER_VALIDATE(offsets_[i] <= offsets_[i + 1],
+                       << "primary file at '" << filename
+                       << "' has a decreasing offset for event " << i + 1);
+    }
+    CELER_VALIDATE(offsets_[num_events_] <= max_primaries
+                       && header.index_offset - sizeof(header)
+                                  - offsets_[num_events_] * sizeof(Primary)
+                              < alignof(std::uint64_t),
+                   << "primary file at '" << filename
+                   << "' has an inconsistent event index");
+
+    // Check that particle IDs have the same meaning
+    auto const* pdgs = reinterpret_cast<std::int32_t const*>(
+        data_ + header.index_offset + index_size);
+    for (auto i : range(header.num_particles))
+    {
+        PDGNumber pdg{pdgs[i]};
+        CELER_VALIDATE(params.find(pdg) == ParticleId(i),
+                       << "particle " << pdg.unchecked_get()
+                       << " in primary file at '" << filename
+                       << "' does not have the same ID as in the problem "
+                          "setup: regenerate the file with the current "
+                          "physics");
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
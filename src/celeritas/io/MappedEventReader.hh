@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/MappedEventReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "EventIOInterface.hh"
+
+namespace celeritas
+{
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Random-access reader for primaries written by \c MappedEventWriter .
+ *
+ * The file is memory-mapped read-only, so accessing an event by ID returns a
+ * view into the mapping without copying or parsing: only the pages for the
+ * events that are actually transported are loaded into memory, and they can
+ * be evicted by the operating system when memory is tight. Random access is
+ * thread-safe and can be used concurrently from multiple streams.
+ *
+ * The particle table stored in the file must match the given particle
+ * parameters, since the primaries store particle IDs rather than PDG numbers.
+ *
+ * \note Platforms without POSIX \c mmap read the whole file into memory.
+ */
+class MappedEventReader : public EventReaderInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticles = std::shared_ptr<ParticleParams const>;
+    using SpanConstPrimary = Span<Primary const>;
+    //!@}
+
+  public:
+    // Map the file and validate it against the particle data
+    MappedEventReader(std::string const& filename,
+                      SPConstParticles const& params);
+
+    // Unmap the file
+    ~MappedEventReader() override;
+
+    //! Prevent copying and moving due to file ownership
+    CELER_DELETE_COPY_MOVE(MappedEventReader);
+
+    // Access the primaries of a single event without copying
+    inline SpanConstPrimary operator()(EventId event_id) const;
+
+    // Copy the primaries of the next event
+    result_type operator()() final;
+
+    //! Get total number of events
+    size_type num_events() const final { return num_events_; }
+
+  private:
+    char const* data_{nullptr};
+    std::size_t size_{0};
+    std::vector<char> buffer_;
+
+    Primary const* primaries_{nullptr};
+    std::uint64_t const* offsets_{nullptr};
+    size_type num_events_{0};
+    EventId next_event_{0};
+
+    // Check the file contents and set up views into the data
+    void validate(std::string const& filename, ParticleParams const& params);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Access the primaries of a single event without copying.
+ */
+auto MappedEventReader::operator()(EventId event_id) const -> SpanConstPrimary
+{
+    CELER_EXPECT(event_id < num_events_);
+    return {primaries_ + offsets_[event_id.get()],
+            primaries_ + offsets_[event_id.get() + 1]};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
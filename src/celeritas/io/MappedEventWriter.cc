@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/MappedEventWriter.cc
+//---------------------------------------------------------------------------//
+#include "MappedEventWriter.hh"
+
+#include <cstring>
+#include <set>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Join.hh"
+#include "corecel/io/Logger.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "detail/MappedEventFormat.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with output filename and particle data.
+ */
+MappedEventWriter::MappedEventWriter(std::string const& filename,
+                                     SPConstParticles params)
+    : params_(std::move(params))
+    , out_(filename, std::ios::out | std::ios::binary)
+    , offsets_{0}
+{
+    CELER_EXPECT(params_);
+    CELER_VALIDATE(out_,
+                   << "failed to open primary output file at '" << filename
+                   << "'");
+
+    CELER_LOG(info) << "Writing mapped primaries to " << filename;
+
+    // Reserve space for the header, which is written at the end
+    detail::MappedEventHeader header{};
+    out_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the event index and particle table.
+ */
+MappedEventWriter::~MappedEventWriter()
+{
+    detail::MappedEventHeader header{};
+    std::memcpy(header.magic,
+                detail::mapped_event_magic,
+                sizeof(header.magic));
+    header.primary_size = sizeof(Primary);
+    header.real_size = sizeof(real_type);
+    header.unit_system = static_cast<std::uint32_t>(UnitSystem::native);
+    header.num_particles = params_->size();
+    header.num_events = offsets_.size() - 1;
+
+    // Pad the end of the primary data so the offsets can be read in place
+    constexpr std::size_t index_align = alignof(std::uint64_t);
+    std::uint64_t const data_end = out_.tellp();
+    char const padding[index_align] = {};
+    out_.write(padding, (index_align - data_end % index_align) % index_align);
+    header.index_offset = out_.tellp();
+
+    out_.write(reinterpret_cast<char const*>(offsets_.data()),
+               offsets_.size() * sizeof(std::uint64_t));
+    for (auto pid : range(ParticleId{params_->size()}))
+    {
+        std::int32_t pdg = params_->id_to_pdg(pid).unchecked_get();
+        out_.write(reinterpret_cast<char const*>(&pdg), sizeof(pdg));
+    }
+
+    out_.seekp(0);
+    out_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    out_.close();
+    if (!out_)
+    {
+        CELER_LOG(error) << "Failed to write mapped primary file";
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all the primaries from a single event.
+ */
+void MappedEventWriter::operator()(VecPrimary const& primaries)
+{
+    CELER_EXPECT(!primaries.empty());
+
+    EventId const event_id(offsets_.size() - 1);
+
+    std::set<EventId::size_type> mismatched_events;
+    buffer_.resize(primaries.size());
+    // Zero padding bytes so the file contents are deterministic
+    std::memset(static_cast<void*>(buffer_.data()),
+                0,
+                buffer_.size() * sizeof(Primary));
+    for (auto i : range(primaries.size()))
+    {
+        Primary const& p = primaries[i];
+        if (p.event_id != event_id)
+        {
+            mismatched_events.insert(p.event_id.unchecked_get());
+        }
+
+        Primary& dst = buffer_[i];
+        dst.particle_id = p.particle_id;
+        dst.energy = p.energy;
+        dst.position = p.position;
+        dst.direction = p.direction;
+        dst.time = p.time;
+        dst.event_id = event_id;
+        dst.track_id = TrackId(i);
+    }
+
+    if (!mismatched_events.empty())
+    {
+        CELER_LOG_LOCAL(warning)
+            << "Overwriting primary event IDs with " << event_id.get() << ": "
+            << join(mismatched_events.begin(), mismatched_events.end(), ", ");
+    }
+
+    out_.write(reinterpret_cast<char const*>(buffer_.data()),
+               buffer_.size() * sizeof(Primary));
+    offsets_.push_back(offsets_.back() + buffer_.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,73 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/MappedEventWriter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "EventIOInterface.hh"
+
+namespace celeritas
+{
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write primaries to a binary file that can be memory-mapped.
+ *
+ * Events are written with contiguous event IDs and with track IDs numbered
+ * from zero in each event, so that \c MappedEventReader can hand them to
+ * transport without modification. The event index is written when the writer
+ * is destroyed.
+ *
+ * Any other event reader can be converted:
+ * \code
+    MappedEventWriter write_event("primaries.celprim", particles);
+    EventReader read_event("primaries.hepmc3", particles);
+    for (auto event = read_event(); !event.empty(); event = read_event())
+    {
+        write_event(event);
+    }
+ * \endcode
+ */
+class MappedEventWriter : public EventWriterInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticles = std::shared_ptr<ParticleParams const>;
+    //!@}
+
+  public:
+    // Construct with output filename and particle data
+    MappedEventWriter(std::string const& filename, SPConstParticles params);
+
+    // Write the event index and particle table
+    ~MappedEventWriter() override;
+
+    //! Prevent copying and moving due to file ownership
+    CELER_DELETE_COPY_MOVE(MappedEventWriter);
+
+    // Write all the primaries from a single event
+    void operator()(VecPrimary const& primaries) final;
+
+  private:
+    SPConstParticles params_;
+    std::ofstream out_;
+    std::vector<std::uint64_t> offsets_;
+    VecPrimary buffer_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/detail/MappedEventFormat.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fixed-size header at the start of a mapped primary file.
+ *
+ * The file layout is:
+ * \verbatim
+   header:  MappedEventHeader
+   data:    Primary records for all events, contiguous and ordered by event
+   padding: zero bytes so that the index is aligned for u64
+   index:   u64 offsets[num_events + 1] into the primary records
+   table:   i32 pdg[num_particles] for each ParticleId used to write the file
+ * \endverbatim
+ * The primaries are stored in memory layout, so they are valid only for the
+ * build configuration (real type and unit system) that wrote them.
+ */
+struct MappedEventHeader
+{
+    char magic[8];
+    std::uint32_t primary_size;
+    std::uint32_t real_size;
+    std::uint32_t unit_system;
+    std::uint32_t num_particles;
+    std::uint64_t num_events;
+    std::uint64_t index_offset;
+};
+
+static_assert(sizeof(MappedEventHeader) % alignof(std::uint64_t) == 0,
+              "primary records must start aligned");
+
+//! Magic string identifying the file type and version
+inline constexpr char mapped_event_magic[] = "CELPRIM1";
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
+
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
@@ -58,6 +60,7 @@ class TabulatedElementSelector
     GridIdValues const& ids_;
     Values const& reals_;
     Energy const energy_;
+    real_type const log_energy_;
 };
 
 //---------------------------------------------------------------------------//
@@ -72,7 +75,12 @@ TabulatedElementSelector::TabulatedElementSelector(ValueTable const& table,
                                                    GridIdValues const& ids,
                                                    Values const& reals,
                                                    Energy energy)
-    : table_(table), grids_(grids), ids_(ids), reals_(reals), energy_(energy)
+    : table_(table)
+    , grids_(grids)
+    , ids_(ids)
+    , reals_(reals)
+    , energy_(energy)
+    , log_energy_(std::log(energy.value()))
 {
     CELER_EXPECT(table);
 }
@@ -92,7 +100,7 @@ TabulatedElementSelector::operator()(Engine& rng) const
         ValueGridId grid_id = ids_[table_.grids[i]];
         CELER_ASSERT(grid_id < grids_.size());
         XsCalculator calc_xs(grids_[grid_id], reals_);
-        if (calc_xs(energy_) > u)
+        if (calc_xs(energy_, log_energy_) > u)
             break;
     }
     return ElementComponentId{i};
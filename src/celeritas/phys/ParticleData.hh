@@ -128,13 +128,15 @@ struct ParticleStateData
     Items<ParticleId> particle_id;  //!< Type of particle (electron, gamma,
                                     //!< ...)
     Items<real_type> particle_energy;  //!< Kinetic energy [MeV]
+    Items<real_type> log_energy;  //!< Log of kinetic energy [log MeV]
 
     //// METHODS ////
 
     //! Whether the interface is assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return !particle_id.empty() && !particle_energy.empty();
+        return !particle_id.empty() && !particle_energy.empty()
+               && !log_energy.empty();
     }
 
     //! State size
@@ -150,6 +152,7 @@ struct ParticleStateData
         CELER_EXPECT(other);
         particle_id = other.particle_id;
         particle_energy = other.particle_energy;
+        log_energy = other.log_energy;
         return *this;
     }
 };
@@ -166,6 +169,7 @@ inline void resize(ParticleStateData<Ownership::value, M>* data,
     CELER_EXPECT(size > 0);
     resize(&data->particle_id, size);
     resize(&data->particle_energy, size);
+    resize(&data->log_energy, size);
 }
 
 //---------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/Quantities.hh"
 
@@ -67,6 +68,9 @@ class ParticleTrackView
     // Kinetic energy [MeV]
     CELER_FORCEINLINE_FUNCTION Energy energy() const;
 
+    // Natural log of the kinetic energy [log MeV]
+    CELER_FORCEINLINE_FUNCTION real_type log_energy() const;
+
     // Whether the particle is stopped (zero kinetic energy)
     CELER_FORCEINLINE_FUNCTION bool is_stopped() const;
 
@@ -110,6 +114,9 @@ class ParticleTrackView
     ParticleParamsRef const& params_;
     ParticleStateRef const& states_;
     TrackSlotId const track_slot_;
+
+    // Save the energy and its logarithm
+    inline CELER_FUNCTION void set_energy(real_type value);
 };
 
 //---------------------------------------------------------------------------//
@@ -137,7 +144,7 @@ ParticleTrackView::operator=(Initializer_t const& other)
     CELER_EXPECT(other.particle_id < params_.size());
     CELER_EXPECT(other.energy >= zero_quantity());
     states_.particle_id[track_slot_] = other.particle_id;
-    states_.particle_energy[track_slot_] = other.energy.value();
+    this->set_energy(other.energy.value());
     return *this;
 }
 
@@ -153,7 +160,7 @@ void ParticleTrackView::energy(Energy quantity)
 {
     CELER_EXPECT(this->particle_id());
     CELER_EXPECT(quantity >= zero_quantity());
-    states_.particle_energy[track_slot_] = quantity.value();
+    this->set_energy(quantity.value());
 }
 
 //---------------------------------------------------------------------------//
@@ -164,8 +171,10 @@ CELER_FUNCTION void ParticleTrackView::subtract_energy(Energy eloss)
 {
     CELER_EXPECT(eloss >= zero_quantity());
     CELER_EXPECT(eloss <= this->energy());
-    // TODO: save a read/write by only saving if eloss is positive?
-    states_.particle_energy[track_slot_] -= eloss.value();
+    if (eloss > zero_quantity())
+    {
+        this->set_energy(states_.particle_energy[track_slot_] - eloss.value());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -188,6 +197,19 @@ CELER_FUNCTION auto ParticleTrackView::energy() const -> Energy
     return Energy{states_.particle_energy[track_slot_]};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Natural log of the kinetic energy [log MeV].
+ *
+ * This is cached whenever the energy changes so that the many grid
+ * calculators evaluated at the same energy during a step don't each have to
+ * call \c std::log . It is negative infinity for a stopped particle.
+ */
+CELER_FUNCTION real_type ParticleTrackView::log_energy() const
+{
+    return states_.log_energy[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is stopped (zero kinetic energy).
@@ -380,5 +402,19 @@ CELER_FUNCTION units::MevMomentum ParticleTrackView::momentum() const
     return units::MevMomentum{std::sqrt(this->momentum_sq().value())};
 }
 
+//---------------------------------------------------------------------------//
+// PRIVATE METHODS
+//---------------------------------------------------------------------------//
+/*!
+ * Save the energy and its logarithm.
+ */
+CELER_FUNCTION void ParticleTrackView::set_energy(real_type value)
+{
+    states_.particle_energy[track_slot_] = value;
+    states_.log_energy[track_slot_]
+        = value > 0 ? std::log(value)
+                    : -numeric_limits<real_type>::infinity();
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -125,7 +125,10 @@ struct IntegralXsProcess
  * be \code tables[ValueGridType::macro_xs][2] \endcode. This
  * awkward access is encapsulated by the PhysicsTrackView. \c integral_xs will
  * only be assigned if the integral approach is used and the particle has
- * continuous-discrete processes.
+ * continuous-discrete processes. \c xs_majorant is an upper bound on the
+ * total macroscopic cross section of all the processes, used to defer the
+ * per-process cross section calculation until a discrete interaction occurs.
+ * It is only assigned if requested and if no process is hardwired.
  */
 struct ProcessGroup
 {
@@ -133,6 +136,7 @@ struct ProcessGroup
     ValueGridArray<ItemRange<ValueTable>> tables;  //!< [vgt][ppid]
     ItemRange<IntegralXsProcess> integral_xs;  //!< [ppid]
     ItemRange<ModelGroup> models;  //!< Model applicability [ppid]
+    ValueTable xs_majorant;  //!< Upper bound on total macro xs [mat]
     ParticleProcessId eloss_ppid{};  //!< Process with de/dx and range tables
     bool has_at_rest{};  //!< Whether the particle type has an at-rest process
 
@@ -314,6 +318,12 @@ struct PhysicsParamsScalars
        =
  params.particle[1].table[int(ValueGridType::macro_xs)][0].material[2].log_energy;
  * \endcode
+ *
+ * If the \c compact_tables option is used, the macroscopic cross section
+ * grids are stored in single precision in \c compact_grids and
+ * \c compact_reals , indexed by the same \c ValueGridId ; the corresponding
+ * entries of \c value_grids are left empty. Energy loss, range, majorant, and
+ * element selection grids are always stored as \c real_type .
  */
 template<Ownership W, MemSpace M>
 struct PhysicsParamsData
@@ -326,6 +336,8 @@ struct PhysicsParamsData
     using ParticleItems = Collection<T, W, M, ParticleId>;
     template<class T>
     using ParticleModelItems = Collection<T, W, M, ParticleModelId>;
+    template<class T>
+    using ValueGridItems = Collection<T, W, M, ValueGridId>;
 
     //// DATA ////
 
@@ -343,6 +355,10 @@ struct PhysicsParamsData
     ParticleModelItems<ModelId> model_ids;
     ParticleModelItems<ModelXsTable> model_xs;
 
+    // Single-precision cross section storage
+    Items<float> compact_reals;
+    ValueGridItems<XsGridRecord<float>> compact_grids;
+
     // Special data
     HardwiredModels<W, M> hardwired;
 
@@ -375,6 +391,8 @@ struct PhysicsParamsData
         process_groups = other.process_groups;
         model_ids = other.model_ids;
         model_xs = other.model_xs;
+        compact_reals = other.compact_reals;
+        compact_grids = other.compact_grids;
 
         hardwired = other.hardwired;
 
@@ -395,6 +413,7 @@ struct PhysicsParamsData
  *
  * State that is reset at every step:
  * - Current macroscopic cross section
+ * - Pre-step energy if the per-process cross sections are deferred
  * - Within-step energy deposition
  * - Within-step energy loss range
  * - Secondaries emitted from an interaction
@@ -406,6 +425,7 @@ struct PhysicsTrackState
 
     // TEMPORARY STATE
     real_type macro_xs;  //!< Total cross section for discrete interactions
+    real_type majorant_energy;  //!< Energy if per-process xs deferred [MeV]
     real_type energy_deposition;  //!< Local energy deposition in a step [MeV]
     real_type dedx_range;  //!< Local energy loss range [len]
     MscRange msc_range;  //!< Range properties for multiple scattering
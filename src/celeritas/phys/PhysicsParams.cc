@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
+#include <limits>
 #include <map>
 #include <set>
 #include <string_view>
@@ -20,17 +22,19 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/DataCache.hh"
+#include "corecel/data/DedupeCollectionBuilder.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/grid/UniformGrid.hh"
 #include "corecel/io/Label.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/math/HashUtils.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/em/data/AtomicRelaxationData.hh"
 #include "celeritas/em/data/EPlusGGData.hh"
 #include "celeritas/em/data/LivermorePEData.hh"
-#include "celeritas/em/model/CombinedBremModel.hh"
 #include "celeritas/em/model/EPlusGGModel.hh"
 #include "celeritas/em/model/LivermorePEModel.hh"
 #include "celeritas/em/params/AtomicRelaxationParams.hh"  // IWYU pragma: keep
@@ -142,13 +146,6 @@ PhysicsParams::PhysicsParams(Input inp)
         failure_action_ = std::move(failure_action);
     }
 
-    // Construct data
-    HostValue host_data;
-    this->build_options(inp.options, &host_data);
-    this->build_ids(*inp.particles, &host_data);
-    this->build_xs(inp.options, *inp.materials, &host_data);
-    this->build_model_xs(*inp.materials, &host_data);
-
     // Add step limiter if being used (TODO: remove this hack from physics)
     if (inp.options.fixed_step_limiter > 0)
     {
@@ -160,13 +157,40 @@ PhysicsParams::PhysicsParams(Input inp)
             "physics-fixed-step",
             "fixed step limiter for charged particles");
         inp.action_registry->insert(fixed_step_action);
-        host_data.scalars.fixed_step_limiter = inp.options.fixed_step_limiter;
-        host_data.scalars.fixed_step_action = fixed_step_action->action_id();
         fixed_step_action_ = std::move(fixed_step_action);
     }
 
-    // Copy data to device
-    data_ = CollectionMirror<PhysicsParamsData>{std::move(host_data)};
+    // Construct data (only once per node if params are shared) and copy to
+    // device
+    data_ = CollectionMirror<PhysicsParamsData>{[&] {
+        HostValue host_data;
+        this->build_options(inp.options, &host_data);
+        this->build_ids(*inp.particles, &host_data);
+        if (!this->load_cache(inp, &host_data))
+        {
+            this->build_xs(inp.options, *inp.materials, &host_data);
+            this->build_model_xs(*inp.materials, &host_data);
+            if (inp.options.xs_majorant_bins_per_decade > 0)
+            {
+                this->build_xs_majorant(
+                    inp.options, *inp.materials, &host_data);
+            }
+            if (inp.options.compact_tables)
+            {
+                this->compact_xs(&host_data);
+                this->dedupe_tables(&host_data);
+            }
+            this->save_cache(inp, host_data);
+        }
+        if (fixed_step_action_)
+        {
+            host_data.scalars.fixed_step_limiter
+                = inp.options.fixed_step_limiter;
+            host_data.scalars.fixed_step_action
+                = fixed_step_action_->action_id();
+        }
+        return host_data;
+    }};
 
     CELER_ENSURE(range_action_->action_id()
                  == host_ref().scalars.range_action());
@@ -660,16 +684,6 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                 applic.material = mat_id;
                 auto material = mats.get(mat_id);
 
-                // TODO: Create combined SB + RB micro xs grids or possibly
-                // remove combined bremsstrahlung model
-                CELER_VALIDATE(!(dynamic_cast<CombinedBremModel const*>(&model)
-                                 && material.num_elements() > 1),
-                               << "model '" << model.label()
-                               << "' cannot be used with materials composed "
-                                  "of more than one element (material '"
-                               << mats.id_to_label(mat_id) << "' has "
-                               << material.num_elements() << " elements)");
-
                 // Construct microscopic cross section builders
                 auto builders = model.micro_xs(applic);
                 if (builders.empty())
@@ -766,5 +780,387 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct upper bounds on the total macroscopic cross sections.
+ *
+ * For each particle type and material, a log-spaced grid spanning the
+ * process cross section grids is constructed. In each bin \f$ [E_a, E_b] \f$
+ * the maximum of each process's cross section is found: because the tabulated
+ * cross sections are linear (or inverse-linear) in energy between grid
+ * points, the maximum is at either a bin edge or a process grid point. For
+ * processes using the integral approach, the lower edge is extended to \f$
+ * \xi E_a \f$ to cover the estimated maximum over the step. The sum over
+ * processes bounds the total in the bin, and each majorant grid point takes
+ * the larger bound of its two adjacent bins so that the interpolated majorant
+ * bounds the total everywhere.
+ *
+ * Particles with hardwired (on-the-fly) cross sections are skipped.
+ */
+void PhysicsParams::build_xs_majorant(Options const& opts,
+                                      MaterialParams const& mats,
+                                      HostValue* data) const
+{
+    CELER_EXPECT(*data);
+    CELER_EXPECT(opts.xs_majorant_bins_per_decade > 0);
+
+    // Relative tolerance to account for roundoff in the interpolation
+    constexpr real_type tol = 1e-3;
+
+    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    auto value_grid_ids = make_builder(&data->value_grid_ids);
+    real_type const log_xi = std::log(opts.min_eprime_over_e);
+    auto const& hardwired = data->hardwired;
+
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        ProcessGroup& process_groups = data->process_groups[particle_id];
+        if (!process_groups)
+        {
+            continue;
+        }
+        Span<ProcessId const> processes
+            = data->process_ids[process_groups.processes];
+        if (std::any_of(processes.begin(), processes.end(), [&](ProcessId p) {
+                return p == hardwired.photoelectric
+                       || p == hardwired.positron_annihilation
+                       || p == hardwired.neutron_elastic;
+            }))
+        {
+            // Some cross sections are calculated on the fly
+            continue;
+        }
+
+        std::vector<ValueGridId> temp_grid_ids(mats.size());
+        for (auto mat_id : range(MaterialId{mats.size()}))
+        {
+            auto data_ref = make_const_ref(*data);
+
+            // Gather the cross section grids for this material
+            struct ProcessXs
+            {
+                XsCalculator calc_xs;
+                UniformGrid loge_grid;
+                bool integral;
+            };
+            std::vector<ProcessXs> process_xs;
+            real_type loge_min = std::numeric_limits<real_type>::infinity();
+            real_type loge_max = -loge_min;
+            for (auto pp_idx : range(processes.size()))
+            {
+                ValueTable const& table = data_ref.value_tables
+                    [process_groups.tables[ValueGridType::macro_xs][pp_idx]];
+                if (!table)
+                {
+                    continue;
+                }
+                ValueGridId grid_id
+                    = data_ref.value_grid_ids[table.grids[mat_id.get()]];
+                if (!grid_id)
+                {
+                    continue;
+                }
+                ValueGrid const& grid = data_ref.value_grids[grid_id];
+                bool integral = static_cast<bool>(
+                    data_ref.integral_xs[process_groups.integral_xs[pp_idx]]);
+                process_xs.push_back({XsCalculator(grid, data_ref.reals),
+                                      UniformGrid(grid.log_energy),
+                                      integral});
+                loge_min = std::min(loge_min, grid.log_energy.front);
+                loge_max = std::max(loge_max, grid.log_energy.back);
+            }
+            if (process_xs.empty())
+            {
+                // No discrete interactions in this material
+                continue;
+            }
+
+            // Construct the majorant energy grid
+            auto num_bins = static_cast<size_type>(
+                std::ceil((loge_max - loge_min) / std::log(real_type(10))
+                          * opts.xs_majorant_bins_per_decade));
+            auto loge_grid = UniformGridData::from_bounds(
+                loge_min, loge_max, std::max<size_type>(num_bins, 1) + 1);
+            UniformGrid const majorant_grid(loge_grid);
+
+            // Calculate the bound on the total cross section in each bin
+            std::vector<real_type> bin_xs(majorant_grid.size() - 1, 0);
+            for (auto bin : range(bin_xs.size()))
+            {
+                real_type loge_hi = bin + 2 == majorant_grid.size()
+                                        ? loge_grid.back
+                                        : majorant_grid[bin + 1];
+                for (ProcessXs const& p : process_xs)
+                {
+                    // Cross sections are constant below the grid and
+                    // decrease (or are constant) above it
+                    auto const& grid = p.loge_grid;
+                    auto calc_xs = [&p, &grid](real_type loge) {
+                        if (loge <= grid.front())
+                            return p.calc_xs[0];
+                        if (loge >= grid.back())
+                            return p.calc_xs[grid.size() - 1];
+                        return p.calc_xs(XsCalculator::Energy{std::exp(loge)},
+                                         loge);
+                    };
+
+                    real_type loge_lo = majorant_grid[bin]
+                                        + (p.integral ? log_xi : 0);
+                    real_type xs_max
+                        = std::max(calc_xs(loge_lo), calc_xs(loge_hi));
+                    for (auto i : range(grid.size()))
+                    {
+                        if (grid[i] > loge_lo && grid[i] < loge_hi)
+                        {
+                            xs_max = std::max(xs_max, p.calc_xs[i]);
+                        }
+                    }
+                    bin_xs[bin] += xs_max;
+                }
+            }
+
+            // Bound both adjacent bins at each grid point
+            size_type const last_bin = bin_xs.size() - 1;
+            std::vector<double> xs(majorant_grid.size());
+            for (auto i : range(majorant_grid.size()))
+            {
+                real_type xs_max = std::max(bin_xs[i > 0 ? i - 1 : 0],
+                                            bin_xs[std::min(i, last_bin)]);
+                xs[i] = xs_max * (1 + tol);
+            }
+            temp_grid_ids[mat_id.get()] = insert_grid(loge_grid, make_span(xs));
+        }
+
+        process_groups.xs_majorant.grids
+            = value_grid_ids.insert_back(temp_grid_ids.begin(),
+                                         temp_grid_ids.end());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Store the macroscopic cross section grids in single precision.
+ *
+ * The values are still interpolated in \c real_type , and the cross section
+ * majorant (built beforehand from the full-precision values) has a relative
+ * tolerance much larger than the single-precision roundoff. Identical arrays
+ * of values are stored only once. The full-precision grids are cleared, and
+ * their values are dropped when the reals are deduplicated afterward.
+ */
+void PhysicsParams::compact_xs(HostValue* data) const
+{
+    CELER_EXPECT(*data);
+    CELER_EXPECT(data->compact_grids.empty());
+
+    std::vector<XsGridRecord<float>> grids(data->value_grids.size());
+    DedupeCollectionBuilder<float> insert_reals(&data->compact_reals);
+    std::vector<float> values;
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        ProcessGroup const& process_groups = data->process_groups[particle_id];
+        for (ValueTable const& table : data->value_tables[process_groups.tables
+                                          [ValueGridType::macro_xs]])
+        {
+            for (ValueGridId grid_id : data->value_grid_ids[table.grids])
+            {
+                if (!grid_id || grids[grid_id.get()])
+                {
+                    continue;
+                }
+                ValueGrid& grid = data->value_grids[grid_id];
+                auto full = data->reals[grid.value];
+                values.assign(full.begin(), full.end());
+
+                XsGridRecord<float>& compact = grids[grid_id.get()];
+                compact.log_energy = grid.log_energy;
+                compact.prime_index = grid.prime_index;
+                compact.value
+                    = insert_reals.insert_back(values.begin(), values.end());
+                CELER_ASSERT(compact);
+                grid = {};
+            }
+        }
+    }
+    make_builder(&data->compact_grids).insert_back(grids.begin(), grids.end());
+
+    CELER_LOG(debug) << "Stored " << data->compact_reals.size()
+                     << " cross section values in single precision";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Store identical arrays of reals only once.
+ *
+ * Tables for materials with the same composition and production cuts, e.g.
+ * the model cross section CDFs of materials that differ only in density, have
+ * identical values. This rebuilds the backend storage so that all ranges with
+ * the same values share a single copy. Every range of \c reals in the physics
+ * data must be remapped here.
+ */
+void PhysicsParams::dedupe_tables(HostValue* data) const
+{
+    CELER_EXPECT(*data);
+
+    Collection<real_type, Ownership::value, MemSpace::host> reals;
+
+    // Copy the model energy bounds verbatim: they're built before the cache
+    // is loaded, so they must keep their original locations
+    for (auto mg_id : range(ItemId<ModelGroup>{data->model_groups.size()}))
+    {
+        ItemRange<real_type> const& energy = data->model_groups[mg_id].energy;
+        auto values = data->reals[energy];
+        auto inserted
+            = make_builder(&reals).insert_back(values.begin(), values.end());
+        CELER_ASSERT(inserted.begin() == energy.begin()
+                     && inserted.size() == energy.size());
+    }
+
+    DedupeCollectionBuilder<real_type> insert_reals(&reals);
+    insert_reals.reserve(data->reals.size());
+    auto remap = [&insert_reals, &old = data->reals](ItemRange<real_type>* r) {
+        if (r->empty())
+        {
+            *r = {};
+            return;
+        }
+        auto values = old[*r];
+        *r = insert_reals.insert_back(values.begin(), values.end());
+    };
+
+    for (auto grid_id : range(ValueGridId{data->value_grids.size()}))
+    {
+        remap(&data->value_grids[grid_id].value);
+    }
+    using IntegralXsId = ItemId<IntegralXsProcess>;
+    for (auto ixs_id : range(IntegralXsId{data->integral_xs.size()}))
+    {
+        remap(&data->integral_xs[ixs_id].energy_max_xs);
+    }
+
+    CELER_LOG(debug) << "Deduplicated physics tables from "
+                     << data->reals.size() << " to " << reals.size()
+                     << " values";
+    data->reals = std::move(reals);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the user-provided cache key with the physics configuration.
+ */
+std::size_t PhysicsParams::calc_cache_key(Input const& inp) const
+{
+    Options const& opts = inp.options;
+    std::size_t result = hash_combine(inp.cache_key,
+                                      inp.particles->size(),
+                                      inp.materials->size(),
+                                      opts.min_range,
+                                      opts.max_step_over_range,
+                                      opts.min_eprime_over_e,
+                                      opts.linear_loss_limit,
+                                      opts.lowest_electron_energy.value(),
+                                      opts.disable_integral_xs,
+                                      opts.xs_majorant_bins_per_decade,
+                                      opts.compact_tables);
+    for (auto const& process : processes_)
+    {
+        result = hash_combine(result, process->label());
+    }
+    for (auto const& model : models_)
+    {
+        result = hash_combine(result, model.first->label(), model.second);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load cross section tables from the cache file if available.
+ */
+bool PhysicsParams::load_cache(Input const& inp, HostValue* data) const
+{
+    if (inp.cache_file.empty())
+    {
+        return false;
+    }
+
+    // Read into temporary storage in case the cache is incomplete
+    HostValue temp;
+    DataCacheReader read_cache(inp.cache_file, this->calc_cache_key(inp));
+    if (read_cache)
+    {
+        read_cache(&temp.reals);
+        read_cache(&temp.value_grids);
+        read_cache(&temp.value_grid_ids);
+        read_cache(&temp.value_tables);
+        read_cache(&temp.value_table_ids);
+        read_cache(&temp.integral_xs);
+        read_cache(&temp.process_groups);
+        read_cache(&temp.model_xs);
+        read_cache(&temp.compact_reals);
+        read_cache(&temp.compact_grids);
+    }
+    if (!read_cache.finalize()
+        || temp.process_groups.size() != data->process_groups.size()
+        || temp.model_xs.size() != data->model_ids.size())
+    {
+        return false;
+    }
+
+    CELER_LOG(status) << "Loaded physics tables from '" << inp.cache_file
+                      << "'";
+    data->reals = std::move(temp.reals);
+    data->value_grids = std::move(temp.value_grids);
+    data->value_grid_ids = std::move(temp.value_grid_ids);
+    data->value_tables = std::move(temp.value_tables);
+    data->value_table_ids = std::move(temp.value_table_ids);
+    data->integral_xs = std::move(temp.integral_xs);
+    data->process_groups = std::move(temp.process_groups);
+    data->model_xs = std::move(temp.model_xs);
+    data->compact_reals = std::move(temp.compact_reals);
+    data->compact_grids = std::move(temp.compact_grids);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save cross section tables to the cache file if requested.
+ *
+ * The tables are already complete, so failing to write the cache (e.g.,
+ * because of a missing directory or a full disk) is only a warning. The
+ * writer removes any partially written file.
+ */
+void PhysicsParams::save_cache(Input const& inp, HostValue const& data) const
+{
+    if (inp.cache_file.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        DataCacheWriter write_cache(inp.cache_file,
+                                    this->calc_cache_key(inp));
+        write_cache(data.reals);
+        write_cache(data.value_grids);
+        write_cache(data.value_grid_ids);
+        write_cache(data.value_tables);
+        write_cache(data.value_table_ids);
+        write_cache(data.integral_xs);
+        write_cache(data.process_groups);
+        write_cache(data.model_xs);
+        write_cache(data.compact_reals);
+        write_cache(data.compact_grids);
+        write_cache.finalize();
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(warning) << "Failed to save physics tables to '"
+                           << inp.cache_file << "': " << e.what();
+        return;
+    }
+
+    CELER_LOG(debug) << "Saved physics tables to '" << inp.cache_file << "'";
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
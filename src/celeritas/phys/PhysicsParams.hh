@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -69,6 +71,22 @@ class ParticleParams;
  *   processes use MC integration to sample the discrete interaction length
  *   with the correct probability. Disable this integral approach for all
  *   processes.
+ * - \c xs_majorant_bins_per_decade: if nonzero, tabulate an upper bound on
+ *   the total macroscopic cross section for particles whose processes are
+ *   all tabulated (e.g., electrons), with this many log-spaced bins per
+ *   factor of 10 in energy. The majorant is used to sample the step length,
+ *   and the per-process cross sections are calculated only for tracks that
+ *   undergo a discrete interaction (which may be rejected as a "null
+ *   collision"). This saves work when most steps are limited by range or
+ *   geometry rather than by interactions.
+ * - \c compact_tables: reduce the memory and cache footprint of the tables,
+ *   at the cost of extra setup time and of single-precision roundoff in the
+ *   cross sections. The macroscopic cross section values are stored as
+ *   \c float (but interpolated as \c real_type ), and identical arrays of
+ *   values (e.g., the tables of materials with the same composition and
+ *   production cuts) are stored only once. Energy loss and range tables,
+ *   which are integrated and inverted along the step, keep their full
+ *   precision.
  *
  * NOTE: min_range/max_step_over_range are not accessible through Geant4, and
  * they can also be set to be different for electrons, mu/hadrons, and ions
@@ -102,6 +120,8 @@ struct PhysicsParamsOptions
 
     real_type secondary_stack_factor = 3;
     bool disable_integral_xs = false;
+    size_type xs_majorant_bins_per_decade = 0;
+    bool compact_tables = false;
 };
 
 //---------------------------------------------------------------------------//
@@ -124,6 +144,13 @@ struct PhysicsParamsOptions
  *   due to integral cross sectionl
  * - "integral-rejected": do not apply a discrete interaction
  * - "failure": model failed to allocate secondaries
+ *
+ * Building the cross section and element selection tables can be a large
+ * part of the setup time. If a \c cache_file is given in the input, the
+ * tables are loaded from it if it was written with the same \c cache_key (a
+ * hash of the inputs used to build the processes, such as the imported
+ * physics data), the same processes and models, and the same options.
+ * Otherwise the tables are built and written to the file.
  */
 class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
 {
@@ -152,6 +179,11 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
         ActionRegistry* action_registry = nullptr;
 
         Options options;
+
+        //! Optional file for caching the constructed physics tables
+        std::string cache_file;
+        //! Hash of the inputs used to construct the processes
+        std::size_t cache_key{};
     };
 
   public:
@@ -223,6 +255,14 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
                   MaterialParams const& mats,
                   HostValue* data) const;
     void build_model_xs(MaterialParams const& mats, HostValue* data) const;
+    void build_xs_majorant(Options const& opts,
+                           MaterialParams const& mats,
+                           HostValue* data) const;
+    std::size_t calc_cache_key(Input const& inp) const;
+    void compact_xs(HostValue* data) const;
+    void dedupe_tables(HostValue* data) const;
+    bool load_cache(Input const& inp, HostValue* data) const;
+    void save_cache(Input const& inp, HostValue const& data) const;
 };
 
 //---------------------------------------------------------------------------//
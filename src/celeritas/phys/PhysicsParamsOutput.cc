@@ -104,6 +104,8 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         PPO_SAVE_SIZE(integral_xs);
         PPO_SAVE_SIZE(model_groups);
         PPO_SAVE_SIZE(process_groups);
+        PPO_SAVE_SIZE(compact_reals);
+        PPO_SAVE_SIZE(compact_grids);
 #undef PPO_SAVE_SIZE
         obj["sizes"] = std::move(sizes);
     }
@@ -8,6 +8,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
+
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
@@ -31,23 +33,19 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Calculate physics step limits based on cross sections and range limiters.
+ * Calculate and store the cross sections of all processes for the track.
+ *
+ * For processes using the integral approach, this stores the estimated
+ * maximum cross section over the step. The return value is the sum of the
+ * per-process cross sections.
  */
-inline CELER_FUNCTION StepLimit
-calc_physics_step_limit(MaterialTrackView const& material,
-                        ParticleTrackView const& particle,
-                        PhysicsTrackView& physics,
-                        PhysicsStepView& pstep)
+inline CELER_FUNCTION real_type
+calc_per_process_xs(MaterialView const& material,
+                    units::MevEnergy energy,
+                    real_type log_energy,
+                    PhysicsTrackView const& physics,
+                    PhysicsStepView& pstep)
 {
-    CELER_EXPECT(physics.has_interaction_mfp());
-
-    using VGT = ValueGridType;
-
-    /*! \todo For particles with decay, macro XS calculation will incorporate
-     * decay probability, dividing decay constant by speed to become 1/len to
-     * compete with interactions.
-     */
-
     // Loop over all processes that apply to this track (based on particle
     // type) and calculate cross section and particle range.
     real_type total_macro_xs = 0;
@@ -59,19 +57,60 @@ calc_physics_step_limit(MaterialTrackView const& material,
             // If the integral approach is used and this particle has an energy
             // loss process, estimate the maximum cross section over the step
             process_xs = physics.calc_max_xs(
-                process, ppid, material.make_material_view(), particle.energy());
+                process, ppid, material, energy, log_energy);
         }
         else
         {
             // Calculate the macroscopic cross section for this process
-            process_xs = physics.calc_xs(
-                ppid, material.make_material_view(), particle.energy());
+            process_xs = physics.calc_xs(ppid, material, energy, log_energy);
         }
         // Accumulate process cross section into the total cross section and
         // save it for later
         total_macro_xs += process_xs;
         pstep.per_process_xs(ppid) = process_xs;
     }
+    return total_macro_xs;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate physics step limits based on cross sections and range limiters.
+ *
+ * If a tabulated majorant of the total cross section is available, it is used
+ * to sample the step length and the per-process cross sections are only
+ * calculated for tracks that reach a discrete interaction.
+ */
+inline CELER_FUNCTION StepLimit
+calc_physics_step_limit(MaterialTrackView const& material,
+                        ParticleTrackView const& particle,
+                        PhysicsTrackView& physics,
+                        PhysicsStepView& pstep)
+{
+    CELER_EXPECT(physics.has_interaction_mfp());
+
+    using VGT = ValueGridType;
+
+    /*! \todo For particles with decay, macro XS calculation will incorporate
+     * decay probability, dividing decay constant by speed to become 1/len to
+     * compete with interactions.
+     */
+
+    real_type total_macro_xs
+        = physics.calc_xs_majorant(particle.energy(), particle.log_energy());
+    if (total_macro_xs > 0)
+    {
+        // Defer the per-process cross sections to the discrete selection
+        pstep.majorant_energy(particle.energy());
+    }
+    else
+    {
+        pstep.majorant_energy(zero_quantity());
+        total_macro_xs = calc_per_process_xs(material.make_material_view(),
+                                             particle.energy(),
+                                             particle.log_energy(),
+                                             physics,
+                                             pstep);
+    }
     pstep.macro_xs(total_macro_xs);
     CELER_ASSERT(total_macro_xs > 0 || !particle.is_stopped());
 
@@ -89,7 +128,8 @@ calc_physics_step_limit(MaterialTrackView const& material,
         {
             auto grid_id = physics.value_grid(VGT::range, ppid);
             auto calc_range = physics.make_calculator<RangeCalculator>(grid_id);
-            real_type range = calc_range(particle.energy());
+            real_type range
+                = calc_range(particle.energy(), particle.log_energy());
             // Save range for the current step and reuse it elsewhere
             physics.dedx_range(range);
 
@@ -194,7 +234,9 @@ calc_mean_energy_loss(ParticleTrackView const& particle,
         CELER_ASSERT(grid_id);
         auto calc_eloss_rate
             = physics.make_calculator<EnergyLossCalculator>(grid_id);
-        eloss = Energy{step * calc_eloss_rate(pre_step_energy)};
+        eloss = Energy{step
+                       * calc_eloss_rate(pre_step_energy,
+                                         particle.log_energy())};
     }
 
     if (eloss >= pre_step_energy * physics.scalars().linear_loss_limit)
@@ -245,6 +287,10 @@ calc_mean_energy_loss(ParticleTrackView const& particle,
  *   section is constant along the step is no longer valid. Use the "integral
  *   approach" to sample the discrete interaction from the correct probability
  *   distribution (section 7.4 of the Geant4 Physics Reference release 10.6).
+ * - If the step was sampled from a majorant of the total cross section, first
+ *   calculate the per-process cross sections at the pre-step energy and
+ *   reject the interaction with probability \f$ 1 - \sigma / \sigma_{maj}
+ *   \f$ (a "null collision"), which is handled like an integral rejection.
  */
 template<class Engine>
 CELER_FUNCTION ActionId
@@ -258,18 +304,34 @@ select_discrete_interaction(MaterialView const& material,
     CELER_EXPECT(physics.interaction_mfp() <= 0);
     CELER_EXPECT(pstep.macro_xs() > 0);
 
+    real_type total_xs = pstep.macro_xs();
+    if (auto energy = pstep.majorant_energy(); energy > zero_quantity())
+    {
+        // Calculate the deferred per-process cross sections
+        total_xs = calc_per_process_xs(
+            material, energy, std::log(energy.value()), physics, pstep);
+        CELER_ASSERT(total_xs <= pstep.macro_xs());
+
+        if (generate_canonical(rng) * pstep.macro_xs() >= total_xs)
+        {
+            // Null collision: no interaction occurs
+            return physics.scalars().integral_rejection_action();
+        }
+    }
+
     // Sample ParticleProcessId from physics.per_process_xs()
     ParticleProcessId ppid = celeritas::make_selector(
         [&pstep](ParticleProcessId ppid) { return pstep.per_process_xs(ppid); },
         ParticleProcessId{physics.num_particle_processes()},
-        pstep.macro_xs())(rng);
+        total_xs)(rng);
 
     // Determine if the discrete interaction occurs for particles with energy
     // loss processes
     if (physics.integral_xs_process(ppid))
     {
         // Recalculate the cross section at the post-step energy \f$ E_1 \f$
-        real_type xs = physics.calc_xs(ppid, material, particle.energy());
+        real_type xs = physics.calc_xs(
+            ppid, material, particle.energy(), particle.log_energy());
 
         // The discrete interaction occurs with probability \f$ \sigma(E_1) /
         // \sigma_{\max} \f$. Note that it's possible for \f$ \sigma(E_1) \f$
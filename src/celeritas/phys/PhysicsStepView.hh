@@ -54,6 +54,9 @@ class PhysicsStepView
     // Set the total (process-integrated) macroscopic xs [len^-1]
     inline CELER_FUNCTION void macro_xs(real_type);
 
+    // Set the pre-step energy if per-process xs are deferred, or zero
+    inline CELER_FUNCTION void majorant_energy(Energy);
+
     // Set the sampled element
     inline CELER_FUNCTION void element(ElementComponentId);
 
@@ -75,6 +78,9 @@ class PhysicsStepView
     // Total (process-integrated) macroscopic xs [len^-1]
     CELER_FORCEINLINE_FUNCTION real_type macro_xs() const;
 
+    // Pre-step energy if the total xs is a majorant, otherwise zero
+    CELER_FORCEINLINE_FUNCTION Energy majorant_energy() const;
+
     // Sampled element for discrete interaction
     CELER_FORCEINLINE_FUNCTION ElementComponentId element() const;
 
@@ -140,6 +146,19 @@ CELER_FUNCTION void PhysicsStepView::macro_xs(real_type inv_distance)
     this->state().macro_xs = inv_distance;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Set the pre-step energy if the per-process cross sections are deferred.
+ *
+ * A nonzero energy indicates that \c macro_xs is an upper bound on the total
+ * cross section and that \c per_process_xs have not been calculated.
+ */
+CELER_FUNCTION void PhysicsStepView::majorant_energy(Energy energy)
+{
+    CELER_EXPECT(energy >= zero_quantity());
+    this->state().majorant_energy = energy.value();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Set the sampled element.
@@ -214,6 +233,15 @@ CELER_FUNCTION real_type PhysicsStepView::macro_xs() const
     return xs;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Pre-step energy if the total cross section is a majorant, otherwise zero.
+ */
+CELER_FUNCTION auto PhysicsStepView::majorant_energy() const -> Energy
+{
+    return Energy{this->state().majorant_energy};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Sampled element for discrete interaction.
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
+
 #include "corecel/Config.hh"
 
 #include "corecel/Assert.hh"
@@ -108,12 +110,29 @@ class PhysicsTrackView
                                             MaterialView const& material,
                                             Energy energy) const;
 
+    // Calculate macroscopic cross section with a precalculated log energy
+    inline CELER_FUNCTION real_type calc_xs(ParticleProcessId ppid,
+                                            MaterialView const& material,
+                                            Energy energy,
+                                            real_type log_energy) const;
+
     // Estimate maximum macroscopic cross section for the process over the step
     inline CELER_FUNCTION real_type calc_max_xs(IntegralXsProcess const& process,
                                                 ParticleProcessId ppid,
                                                 MaterialView const& material,
                                                 Energy energy) const;
 
+    // Estimate maximum macroscopic cross section with a precalculated log
+    inline CELER_FUNCTION real_type calc_max_xs(IntegralXsProcess const& process,
+                                                ParticleProcessId ppid,
+                                                MaterialView const& material,
+                                                Energy energy,
+                                                real_type log_energy) const;
+
+    // Upper bound on the total macroscopic cross section, zero if unavailable
+    inline CELER_FUNCTION real_type calc_xs_majorant(Energy energy,
+                                                     real_type log_energy) const;
+
     // Models that apply to the given process ID
     inline CELER_FUNCTION
         ModelFinder make_model_finder(ParticleProcessId) const;
@@ -399,6 +418,20 @@ CELER_FUNCTION auto PhysicsTrackView::integral_xs_process(
 CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
                                                    MaterialView const& material,
                                                    Energy energy) const
+{
+    return this->calc_xs(ppid, material, energy, std::log(energy.value()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate macroscopic cross section with a precalculated log energy.
+ *
+ * The log energy is only used by tabulated cross sections.
+ */
+CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
+                                                   MaterialView const& material,
+                                                   Energy energy,
+                                                   real_type log_energy) const
 {
     real_type result = 0;
 
@@ -428,8 +461,18 @@ CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
     else if (auto grid_id = this->value_grid(ValueGridType::macro_xs, ppid))
     {
         // Calculate cross section from the tabulated data
-        auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
-        result = calc_xs(energy);
+        if (!params_.compact_grids.empty())
+        {
+            CELER_ASSERT(grid_id < params_.compact_grids.size());
+            CompactXsCalculator calc_xs(params_.compact_grids[grid_id],
+                                        params_.compact_reals);
+            result = calc_xs(energy, log_energy);
+        }
+        else
+        {
+            auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
+            result = calc_xs(energy, log_energy);
+        }
     }
 
     CELER_ENSURE(result >= 0);
@@ -457,6 +500,21 @@ PhysicsTrackView::calc_max_xs(IntegralXsProcess const& process,
                               ParticleProcessId ppid,
                               MaterialView const& material,
                               Energy energy) const
+{
+    return this->calc_max_xs(
+        process, ppid, material, energy, std::log(energy.value()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Estimate maximum macroscopic cross section with a precalculated log energy.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::calc_max_xs(IntegralXsProcess const& process,
+                              ParticleProcessId ppid,
+                              MaterialView const& material,
+                              Energy energy,
+                              real_type log_energy) const
 {
     CELER_EXPECT(process);
     CELER_EXPECT(material_ < process.energy_max_xs.size());
@@ -468,10 +526,44 @@ PhysicsTrackView::calc_max_xs(IntegralXsProcess const& process,
     {
         return this->calc_xs(ppid, material, Energy{energy_max_xs});
     }
-    return max(this->calc_xs(ppid, material, energy),
+    return max(this->calc_xs(ppid, material, energy, log_energy),
                this->calc_xs(ppid, material, Energy{energy_xi}));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Upper bound on the total macroscopic cross section over the step.
+ *
+ * The majorant is tabulated at initialization so that it bounds the sum of
+ * the values from \c calc_max_xs (for processes using the integral approach)
+ * and \c calc_xs (for all others) over each energy bin. The result is zero if
+ * no majorant is tabulated for this particle and material, or if the energy
+ * is outside the tabulated range: the per-process cross sections must then be
+ * calculated directly.
+ */
+CELER_FUNCTION real_type PhysicsTrackView::calc_xs_majorant(
+    Energy energy, real_type log_energy) const
+{
+    ValueTable const& table = this->process_group().xs_majorant;
+    if (!table)
+        return 0;  // Majorant is not used for this particle
+
+    CELER_EXPECT(material_ < table.grids.size());
+    ValueGridId grid_id = params_.value_grid_ids[table.grids[material_.get()]];
+    if (!grid_id)
+        return 0;  // No majorant for this material
+
+    ValueGrid const& grid = params_.value_grids[grid_id];
+    if (!(log_energy >= grid.log_energy.front)
+        || !(log_energy <= grid.log_energy.back))
+    {
+        return 0;  // Outside the tabulated range (or stopped)
+    }
+
+    auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
+    return calc_xs(energy, log_energy);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return the model ID that applies to the given process ID and energy if the
@@ -68,6 +68,7 @@ ProcessBuilder::ProcessBuilder(ImportData const& data,
     , user_build_map_(std::move(user_build))
     , selection_(options.brems_selection)
     , brem_combined_(options.brem_combined)
+    , brem_sb_cdf_(options.brem_sb_cdf)
     , enable_lpm_(data.em_params.lpm)
     , use_integral_xs_(data.em_params.integral_approach)
 {
@@ -175,6 +176,7 @@ auto ProcessBuilder::build_ebrems() -> SPProcess
     BremsstrahlungProcess::Options options;
     options.selection = selection_;
     options.combined_model = brem_combined_;
+    options.use_sb_cdf = brem_sb_cdf_;
     options.enable_lpm = enable_lpm_;
     options.use_integral_xs = use_integral_xs_;
 
@@ -34,6 +34,7 @@ struct ImportLivermorePE;
 struct ProcessBuilderOptions
 {
     bool brem_combined{false};
+    bool brem_sb_cdf{false};
     BremsModelSelection brems_selection{BremsModelSelection::all};
 };
 
@@ -118,6 +119,7 @@ class ProcessBuilder
 
     BremsModelSelection selection_;
     bool brem_combined_;
+    bool brem_sb_cdf_;
     bool enable_lpm_;
     bool use_integral_xs_;
 
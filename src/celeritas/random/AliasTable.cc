@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/AliasTable.cc
+//---------------------------------------------------------------------------//
+#include "AliasTable.hh"
+
+#include <numeric>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct an alias table from unnormalized nonnegative weights.
+ *
+ * This uses Vose's variant of Walker's alias method: the weights are scaled
+ * so that their mean is one, and each "underfull" bin is topped off with
+ * probability from an "overfull" one. The bins left at the end (exactly full
+ * up to roundoff) always select themselves. The resulting table is sampled
+ * with \c AliasSelector.
+ */
+std::vector<AliasTableEntry> make_alias_table(Span<double const> weights)
+{
+    CELER_EXPECT(!weights.empty());
+
+    double const total = std::accumulate(weights.begin(), weights.end(), 0.0);
+    CELER_VALIDATE(total > 0,
+                   << "cannot build an alias table from weights with a "
+                      "nonpositive sum "
+                   << total);
+
+    size_type const size = weights.size();
+    std::vector<double> scaled(size);
+    std::vector<size_type> small;
+    std::vector<size_type> large;
+    for (auto i : range(size))
+    {
+        CELER_VALIDATE(weights[i] >= 0,
+                       << "invalid alias table weight " << weights[i]
+                       << " (must be nonnegative)");
+        scaled[i] = weights[i] * size / total;
+        (scaled[i] < 1 ? small : large).push_back(i);
+    }
+
+    std::vector<AliasTableEntry> result(size);
+    while (!small.empty() && !large.empty())
+    {
+        size_type const lo = small.back();
+        small.pop_back();
+        size_type const hi = large.back();
+
+        result[lo].threshold = scaled[lo];
+        result[lo].alias = hi;
+
+        // Move the probability used to fill the underfull bin
+        scaled[hi] = (scaled[hi] + scaled[lo]) - 1;
+        if (scaled[hi] < 1)
+        {
+            large.pop_back();
+            small.push_back(hi);
+        }
+    }
+
+    // Remaining bins are full up to roundoff
+    for (auto const* remaining : {&small, &large})
+    {
+        for (size_type i : *remaining)
+        {
+            result[i].threshold = 1;
+            result[i].alias = i;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,23 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/AliasTable.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/cont/Span.hh"
+
+#include "Selector.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Construct an alias table from unnormalized nonnegative weights
+std::vector<AliasTableEntry> make_alias_table(Span<double const> weights);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -9,7 +9,9 @@
 
 #include <type_traits>
 
+#include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/math/Algorithms.hh"
 #include "corecel/math/SoftEqual.hh"
 
@@ -85,6 +87,58 @@ make_selector(F&& func, T size, decltype(func(size)) total = 1)
     return {celeritas::forward<F>(func), size, total};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Bin of a precomputed alias table.
+ *
+ * Each bin holds the fraction of its width that selects the bin's own index;
+ * the rest of the bin selects the \c alias index.
+ */
+struct AliasTableEntry
+{
+    real_type threshold{1};  //!< Probability of selecting this bin
+    size_type alias{0};  //!< Index selected otherwise
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Constant-time selection of a discrete distribution from an alias table.
+ *
+ * This samples from the same distributions as \c Selector but uses a table
+ * precomputed by \c make_alias_table (Walker's alias method) so that the
+ * cost is independent of the number of entries. A single random number
+ * chooses a bin uniformly and, using its remaining bits, whether to select the
+ * bin or its alias. It should be used when the distribution is fixed at setup
+ * time and the number of entries is large, e.g. for the atomic transitions of
+ * high-Z elements.
+ *
+ * \code
+    AliasSelector<TransitionId> select_transition(alias_table);
+    TransitionId t = select_transition(rng);
+   \endcode
+ */
+template<class T>
+class AliasSelector
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using value_type = T;
+    using SpanConstEntry = Span<AliasTableEntry const>;
+    //!@}
+
+  public:
+    // Construct with a precomputed table
+    explicit inline CELER_FUNCTION AliasSelector(SpanConstEntry table);
+
+    // Sample from the distribution
+    template<class Engine>
+    inline CELER_FUNCTION T operator()(Engine& rng) const;
+
+  private:
+    SpanConstEntry table_;
+};
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -142,5 +196,31 @@ CELER_FUNCTION auto Selector<F, T>::debug_accumulated_total() const -> real_type
     return accum;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a precomputed table.
+ */
+template<class T>
+CELER_FUNCTION AliasSelector<T>::AliasSelector(SpanConstEntry table)
+    : table_{table}
+{
+    CELER_EXPECT(!table_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample from the distribution.
+ */
+template<class T>
+template<class Engine>
+CELER_FUNCTION T AliasSelector<T>::operator()(Engine& rng) const
+{
+    real_type const scaled = generate_canonical(rng) * table_.size();
+    size_type const bin
+        = celeritas::min(static_cast<size_type>(scaled), table_.size() - 1);
+    AliasTableEntry const& entry = table_[bin];
+    return T{scaled - bin < entry.threshold ? bin : entry.alias};
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
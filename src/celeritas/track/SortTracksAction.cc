@@ -35,6 +35,7 @@ bool is_sort_trackorder(TrackOrder to)
         TrackOrder::sort_along_step_action,
         TrackOrder::sort_action,
         TrackOrder::sort_particle_type,
+        TrackOrder::sort_material,
     };
     return std::find(std::begin(allowed), std::end(allowed), to)
            != std::end(allowed);
@@ -81,6 +82,10 @@ SortTracksAction::SortTracksAction(ActionId id, TrackOrder track_order)
             case TrackOrder::sort_particle_type:
                 // Sorth at the beginning of the step
                 return StepActionOrder::sort_start;
+            case TrackOrder::sort_material:
+                // Material is updated at initialization and boundary
+                // crossings, so it is current at the beginning of the step
+                return StepActionOrder::sort_start;
             default:
                 CELER_ASSERT_UNREACHABLE();
         }
@@ -103,6 +108,8 @@ std::string_view SortTracksAction::label() const
             return "sort-tracks-post-step";
         case TrackOrder::sort_particle_type:
             return "sort-tracks-start";
+        case TrackOrder::sort_material:
+            return "sort-tracks-material";
         default:
             CELER_ASSERT_UNREACHABLE();
     }
@@ -113,15 +120,15 @@ std::string_view SortTracksAction::label() const
  */
 void SortTracksAction::step(CoreParams const&, CoreStateHost& state) const
 {
-    detail::sort_tracks(state.ref(), track_order_);
+    // The host counting sort computes the action offsets directly
+    Span<ThreadId> offsets;
     if (is_sort_by_action(track_order_))
     {
-        detail::count_tracks_per_action(
-            state.ref(),
-            state.action_thread_offsets()[AllItems<ThreadId, MemSpace::host>{}],
-            state.action_thread_offsets(),
-            track_order_);
+        offsets = state.action_thread_offsets()[AllItems<ThreadId,
+                                                         MemSpace::host>{}];
     }
+    detail::sort_tracks(
+        state.ref(), track_order_, offsets, &state.sort_buffers());
 }
 
 //---------------------------------------------------------------------------//
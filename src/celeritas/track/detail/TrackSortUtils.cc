@@ -10,8 +10,16 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <vector>
+
+#include "corecel/Config.hh"
 
 #include "corecel/data/Collection.hh"
+#include "celeritas/global/detail/CoreStateThreadOffsets.hh"
+
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    include <omp.h>
+#endif
 
 namespace celeritas
 {
@@ -28,38 +36,155 @@ using ThreadItems
 using TrackSlots = ThreadItems<TrackSlotId::size_type>;
 
 //---------------------------------------------------------------------------//
-//! Partition track slots based on a unary predicate
+//! Map a track slot to a counting-sort bucket using its status
+struct StatusKey
+{
+    ObserverPtr<TrackStatus const> status_;
+
+    size_type operator()(size_type track_slot) const
+    {
+        return status_.get()[track_slot] == TrackStatus::inactive ? 1 : 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Map a track slot to a counting-sort bucket using an ID accessor
 template<class F>
-void partition_impl(TrackSlots const& track_slots, F&& func)
+struct IdKey
 {
-    auto* start = track_slots.data().get();
-    std::partition(start, start + track_slots.size(), std::forward<F>(func));
-}
+    F get_id;
+    size_type null_key;  //!< Bucket for null IDs, sorted after valid IDs
+
+    size_type operator()(size_type track_slot) const
+    {
+        auto id = get_id(track_slot);
+        return id ? id.unchecked_get() : null_key;
+    }
+};
 
 //---------------------------------------------------------------------------//
-//! Sort track slots based on a binary predicate
+/*!
+ * Construct a key for a dense ID type.
+ *
+ * The number of valid keys is given by the largest ID present in the state,
+ * and null IDs are placed in a final bucket.
+ */
 template<class F>
-void sort_impl(TrackSlots const& track_slots, F&& func)
+IdKey<F> make_id_key(F get_id, size_type size)
 {
-    auto* start = track_slots.data().get();
-    std::sort(start, start + track_slots.size(), std::forward<F>(func));
+    size_type num_valid = 0;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for reduction(max : num_valid)
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        if (auto id = get_id(i))
+        {
+            num_valid = std::max(num_valid, id.unchecked_get() + 1);
+        }
+    }
+    return {get_id, num_valid};
 }
 
 //---------------------------------------------------------------------------//
-//! Compare indices by indirection from a track slot index
-template<class Id>
-struct IdLess
+/*!
+ * Stable counting sort of track slots into a small number of dense buckets.
+ *
+ * Each thread histograms a contiguous chunk of the track slots, an exclusive
+ * scan over (bucket, chunk) gives each thread its scatter offsets, and the
+ * slots are scattered into a temporary buffer and copied back. If \c
+ * offsets is nonempty, the starting thread of each nonempty bucket is written
+ * to it (missing entries are left as null for \c backfill_action_count ).
+ * The histogram and scatter buffers are kept between calls to avoid
+ * allocating every step.
+ */
+template<class F>
+void counting_sort_impl(TrackSlots const& track_slots,
+                        size_type num_keys,
+                        F&& get_key,
+                        Span<ThreadId> offsets,
+                        TrackSortBuffers* buffers)
 {
-    ObserverPtr<Id const> ids_;
+    CELER_EXPECT(num_keys > 0);
+    CELER_EXPECT(buffers);
+
+    using SlotT = TrackSlotId::size_type;
+    SlotT* const slots = track_slots.data().get();
+    size_type const size = track_slots.size();
+
+    int num_chunks = 1;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    num_chunks = omp_get_max_threads();
+#endif
+    auto chunk_begin = [size, num_chunks](int chunk) {
+        return static_cast<size_type>(std::size_t{size}
+                                      * static_cast<std::size_t>(chunk)
+                                      / static_cast<std::size_t>(num_chunks));
+    };
+
+    // Histogram each chunk: counts[chunk * num_keys + key]
+    auto& counts = buffers->counts;
+    counts.assign(std::size_t{num_keys} * num_chunks, 0);
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (int chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        size_type* chunk_counts = counts.data() + chunk * num_keys;
+        for (size_type i = chunk_begin(chunk), stop = chunk_begin(chunk + 1);
+             i < stop;
+             ++i)
+        {
+            size_type key = get_key(slots[i]);
+            CELER_ASSERT(key < num_keys);
+            ++chunk_counts[key];
+        }
+    }
 
-    bool operator()(size_type a, size_type b) const
+    // Convert counts to starting offsets, ordered by key and then by chunk
+    size_type total = 0;
+    for (size_type key = 0; key < num_keys; ++key)
     {
-        return ids_.get()[a] < ids_.get()[b];
+        size_type const key_start = total;
+        for (int chunk = 0; chunk < num_chunks; ++chunk)
+        {
+            size_type& count = counts[chunk * num_keys + key];
+            size_type const start = total;
+            total += count;
+            count = start;
+        }
+        if (key + 1 < offsets.size() && total != key_start)
+        {
+            offsets[key] = ThreadId{key_start};
+        }
+    }
+    CELER_ASSERT(total == size);
+
+    // Scatter each chunk into its reserved range
+    auto& sorted = buffers->slots;
+    sorted.resize(size);
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (int chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        size_type* chunk_offsets = counts.data() + chunk * num_keys;
+        for (size_type i = chunk_begin(chunk), stop = chunk_begin(chunk + 1);
+             i < stop;
+             ++i)
+        {
+            sorted[chunk_offsets[get_key(slots[i])]++] = slots[i];
+        }
     }
-};
 
-template<class Id>
-IdLess(ObserverPtr<Id>) -> IdLess<Id>;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        slots[i] = sorted[i];
+    }
+}
 
 //---------------------------------------------------------------------------//
 }  // namespace
@@ -67,21 +192,81 @@ IdLess(ObserverPtr<Id>) -> IdLess<Id>;
 //---------------------------------------------------------------------------//
 /*!
  * Sort or partition tracks.
+ *
+ * Since all sort keys are small dense integers, this uses a (parallel, if
+ * track-level OpenMP is enabled) counting sort rather than a comparison sort.
  */
 void sort_tracks(HostRef<CoreStateData> const& states, TrackOrder order)
 {
+    TrackSortBuffers buffers;
+    return sort_tracks(states, order, {}, &buffers);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort or partition tracks, saving the starting thread of each action.
+ *
+ * When sorting by action and \c offsets is nonempty (size num_actions + 1),
+ * the per-action thread offsets are computed as part of the sort, so a
+ * separate call to \c count_tracks_per_action is unnecessary. The temporary
+ * storage should persist with the state so that it's reused every step.
+ */
+void sort_tracks(HostRef<CoreStateData> const& states,
+                 TrackOrder order,
+                 Span<ThreadId> offsets,
+                 TrackSortBuffers* buffers)
+{
+    auto const size = states.size();
     switch (order)
     {
         case TrackOrder::partition_status:
-            return partition_impl(states.track_slots,
-                                  IsNotInactive{states.sim.status.data()});
+            return counting_sort_impl(states.track_slots,
+                                      2,
+                                      StatusKey{states.sim.status.data()},
+                                      {},
+                                      buffers);
         case TrackOrder::sort_along_step_action:
-        case TrackOrder::sort_step_limit_action:
-            return sort_impl(states.track_slots,
-                             IdLess{get_action_ptr(states, order)});
-        case TrackOrder::sort_particle_type:
-            return sort_impl(states.track_slots,
-                             IdLess{states.particles.particle_id.data()});
+        case TrackOrder::sort_step_limit_action: {
+            auto get_key = make_id_key(
+                IdAccessor{get_action_ptr(states, order)}, size);
+            if (!offsets.empty())
+            {
+                CELER_ASSERT(offsets.size() >= 2);
+                std::fill(offsets.begin(), offsets.end(), ThreadId{});
+                // Valid actions are always smaller than the null bucket
+                get_key.null_key = std::max(
+                    get_key.null_key,
+                    static_cast<size_type>(offsets.size() - 1));
+            }
+            counting_sort_impl(states.track_slots,
+                               get_key.null_key + 1,
+                               get_key,
+                               offsets,
+                               buffers);
+            if (!offsets.empty())
+            {
+                backfill_action_count(offsets, size);
+            }
+            return;
+        }
+        case TrackOrder::sort_particle_type: {
+            auto get_key = make_id_key(
+                IdAccessor{states.particles.particle_id.data()}, size);
+            return counting_sort_impl(states.track_slots,
+                                      get_key.null_key + 1,
+                                      get_key,
+                                      {},
+                                      buffers);
+        }
+        case TrackOrder::sort_material: {
+            auto get_key = make_id_key(
+                MaterialIdAccessor{states.materials.state.data()}, size);
+            return counting_sort_impl(states.track_slots,
+                                      get_key.null_key + 1,
+                                      get_key,
+                                      {},
+                                      buffers);
+        }
         default:
             CELER_ASSERT_UNREACHABLE();
     }
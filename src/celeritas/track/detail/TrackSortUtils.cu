@@ -8,6 +8,7 @@
 #include "TrackSortUtils.hh"
 
 #include <random>
+#include <type_traits>
 #include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
 #include <thrust/partition.h>
@@ -42,6 +43,10 @@ using ThreadItems
 
 using TrackSlots = ThreadItems<TrackSlotId::size_type>;
 
+//! Integer type of the ID returned by an accessor
+template<class F>
+using IdSizeT = typename std::invoke_result_t<F, size_type>::size_type;
+
 //---------------------------------------------------------------------------//
 /*!
  * Partition track_slots based on predicate.
@@ -62,18 +67,18 @@ void partition_impl(TrackSlots const& track_slots, F&& func, StreamId stream_id)
  * Reorder OpaqueId's based on track_slots so that track_slots[tid] correspond
  * to ids[tid] instead of ids[tacks_slots[tid]].
  */
-template<class Id>
+template<class F>
 __global__ void
 reorder_ids_kernel(ObserverPtr<TrackSlotId::size_type const> track_slots,
-                   ObserverPtr<Id const> ids,
-                   ObserverPtr<typename Id::size_type> ids_out,
+                   F get_id,
+                   ObserverPtr<IdSizeT<F>> ids_out,
                    size_type size)
 {
     if (ThreadId tid = celeritas::KernelParamCalculator::thread_id();
         tid < size)
     {
         ids_out.get()[tid.get()]
-            = ids.get()[track_slots.get()[tid.get()]].unchecked_get();
+            = get_id(track_slots.get()[tid.get()]).unchecked_get();
     }
 }
 
@@ -81,18 +86,16 @@ reorder_ids_kernel(ObserverPtr<TrackSlotId::size_type const> track_slots,
 /*!
  * Sort track slots using ids as keys.
  */
-template<class Id, class IdT = typename Id::size_type>
-void sort_impl(TrackSlots const& track_slots,
-               ObserverPtr<Id const> ids,
-               StreamId stream_id)
+template<class F>
+void sort_impl(TrackSlots const& track_slots, F get_id, StreamId stream_id)
 {
-    DeviceVector<IdT> reordered_ids(track_slots.size(), stream_id);
+    DeviceVector<IdSizeT<F>> reordered_ids(track_slots.size(), stream_id);
     CELER_LAUNCH_KERNEL_TEMPLATE_1(reorder_ids,
-                                   Id,
+                                   F,
                                    track_slots.size(),
                                    celeritas::device().stream(stream_id).get(),
                                    track_slots.data(),
-                                   ids,
+                                   get_id,
                                    make_observer(reordered_ids.data()),
                                    track_slots.size());
     thrust::sort_by_key(thrust_execute_on(stream_id),
@@ -153,15 +156,16 @@ void sort_tracks(DeviceRef<CoreStateData> const& states, TrackOrder order)
         case TrackOrder::sort_along_step_action:
         case TrackOrder::sort_step_limit_action:
             return sort_impl(states.track_slots,
-                             get_action_ptr(states, order),
+                             IdAccessor{get_action_ptr(states, order)},
+                             states.stream_id);
+        case TrackOrder::sort_particle_type:
+            return sort_impl(states.track_slots,
+                             IdAccessor{states.particles.particle_id.data()},
+                             states.stream_id);
+        case TrackOrder::sort_material:
+            return sort_impl(states.track_slots,
+                             MaterialIdAccessor{states.materials.state.data()},
                              states.stream_id);
-        case TrackOrder::sort_particle_type: {
-            using Id =
-                typename decltype(states.particles.particle_id)::value_type;
-            return sort_impl<Id>(states.track_slots,
-                                 states.particles.particle_id.data(),
-                                 states.stream_id);
-        }
         default:
             CELER_ASSERT_UNREACHABLE();
     }
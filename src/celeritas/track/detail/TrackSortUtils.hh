@@ -21,6 +21,8 @@ namespace celeritas
 {
 namespace detail
 {
+struct TrackSortBuffers;
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -30,6 +32,12 @@ namespace detail
 void sort_tracks(HostRef<CoreStateData> const&, TrackOrder);
 void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder);
 
+// Sort tracks on host, writing action offsets as a byproduct
+void sort_tracks(HostRef<CoreStateData> const&,
+                 TrackOrder,
+                 Span<ThreadId>,
+                 TrackSortBuffers*);
+
 //---------------------------------------------------------------------------//
 // Count tracks associated to each action
 void count_tracks_per_action(
@@ -74,6 +82,32 @@ struct ActionAccessor
     }
 };
 
+//! Map from a track slot to an ID by pointer indirection
+template<class Id>
+struct IdAccessor
+{
+    ObserverPtr<Id const> ids_;
+
+    CELER_FUNCTION Id operator()(size_type track_slot) const
+    {
+        return ids_.get()[track_slot];
+    }
+};
+
+template<class T>
+IdAccessor(ObserverPtr<T>) -> IdAccessor<std::remove_const_t<T>>;
+
+//! Map from a track slot to its current material
+struct MaterialIdAccessor
+{
+    ObserverPtr<MaterialTrackState const> state_;
+
+    CELER_FUNCTION MaterialId operator()(size_type track_slot) const
+    {
+        return state_.get()[track_slot].material_id;
+    }
+};
+
 //---------------------------------------------------------------------------//
 //! Return a raw pointer to action IDs based on the given sort order
 template<Ownership W, MemSpace M>
@@ -0,0 +1,375 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/StepColumnWriter.cc
+//---------------------------------------------------------------------------//
+#include "StepColumnWriter.hh"
+
+#include <cstring>
+#include <exception>
+#include <istream>
+#include <type_traits>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/OpaqueId.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/Quantity.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+constexpr char magic_string[] = "CELSTEP1";
+constexpr std::size_t magic_size = sizeof(magic_string) - 1;
+
+//---------------------------------------------------------------------------//
+//! Convert a state item to a fixed number of scalar components
+template<class T>
+struct ColumnTraits
+{
+    using element_type = T;
+    static constexpr std::uint8_t width = 1;
+    static void copy(T const& value, element_type* dst) { *dst = value; }
+};
+
+template<class V, class S>
+struct ColumnTraits<OpaqueId<V, S>>
+{
+    using element_type = S;
+    static constexpr std::uint8_t width = 1;
+    static void copy(OpaqueId<V, S> const& value, element_type* dst)
+    {
+        *dst = value.unchecked_get();
+    }
+};
+
+template<class U, class T>
+struct ColumnTraits<Quantity<U, T>>
+{
+    using element_type = T;
+    static constexpr std::uint8_t width = 1;
+    static void copy(Quantity<U, T> const& value, element_type* dst)
+    {
+        *dst = value.value();
+    }
+};
+
+template<class T, size_type N>
+struct ColumnTraits<Array<T, N>>
+{
+    using element_type = T;
+    static constexpr std::uint8_t width = N;
+    static void copy(Array<T, N> const& value, element_type* dst)
+    {
+        for (auto i : range(N))
+        {
+            dst[i] = value[i];
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Gather the values of the given rows into a new column.
+ */
+template<class T, class I>
+void append_column(std::string name,
+                   Collection<T, Ownership::reference, MemSpace::host, I> const&
+                       items,
+                   std::vector<size_type> const& rows,
+                   StepColumnChunk* chunk)
+{
+    using Traits = ColumnTraits<T>;
+    using E = typename Traits::element_type;
+    static_assert(std::is_arithmetic_v<E>);
+
+    CELER_VALIDATE(!items.empty(),
+                   << "step attribute '" << name
+                   << "' was selected but not gathered");
+
+    StepColumn col;
+    col.name = std::move(name);
+    col.type = std::is_floating_point_v<E> ? 'f' : 'u';
+    col.type_size = sizeof(E);
+    col.width = Traits::width;
+    col.data.resize(rows.size() * Traits::width * sizeof(E));
+
+    auto values = items[AllItems<T, MemSpace::host>{}];
+    E* dst = reinterpret_cast<E*>(col.data.data());
+    for (size_type r : rows)
+    {
+        Traits::copy(values[r], dst);
+        dst += Traits::width;
+    }
+    chunk->columns.push_back(std::move(col));
+}
+
+//---------------------------------------------------------------------------//
+template<class T>
+void write_value(std::ostream& os, T value)
+{
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template<class T>
+bool read_value(std::istream& is, T* value)
+{
+    is.read(reinterpret_cast<char*>(value), sizeof(T));
+    return static_cast<bool>(is);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a single chunk.
+ */
+void write_chunk(std::ostream& os, StepColumnChunk const& chunk)
+{
+    write_value<std::uint32_t>(os, chunk.stream_id.unchecked_get());
+    write_value<std::uint32_t>(os, chunk.num_rows);
+    write_value<std::uint32_t>(os, chunk.columns.size());
+    for (StepColumn const& col : chunk.columns)
+    {
+        CELER_ASSERT(col.name.size() < 256);
+        write_value<std::uint8_t>(os, col.name.size());
+        os.write(col.name.data(), col.name.size());
+        write_value(os, col.type);
+        write_value(os, col.type_size);
+        write_value(os, col.width);
+        os.write(col.data.data(), col.data.size());
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with output filename and data selection.
+ *
+ * At most \c max_queued chunks wait to be written: beyond that,
+ * \c process_steps blocks until the background thread catches up.
+ */
+StepColumnWriter::StepColumnWriter(std::string const& filename,
+                                   StepSelection selection,
+                                   size_type max_queued)
+    : selection_(selection)
+    , out_(filename, std::ios::out | std::ios::binary)
+    , queue_(max_queued,
+             [this](StepColumnChunk& chunk) { write_chunk(out_, chunk); })
+{
+    CELER_VALIDATE(out_,
+                   << "failed to open step output file at '" << filename
+                   << "'");
+    out_.write(magic_string, magic_size);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write remaining chunks and close the file.
+ */
+StepColumnWriter::~StepColumnWriter()
+{
+    try
+    {
+        this->flush();
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(error) << "Failed to write step column output: "
+                         << e.what();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Gather step data on the host and queue it for writing.
+ */
+void StepColumnWriter::process_steps(HostStepState state)
+{
+    this->write(state.steps.data, state.stream_id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy step data to the host and queue it for writing.
+ *
+ * Only the selected attributes are copied.
+ */
+void StepColumnWriter::process_steps(DeviceStepState state)
+{
+    auto const& src = state.steps.data;
+    StepStateDataImpl<Ownership::value, MemSpace::host> dst;
+
+    dst.track_id = src.track_id;
+#define SCW_COPY_IF_SELECTED(ATTR)     \
+    do                                 \
+    {                                  \
+        if (selection_.ATTR)           \
+        {                              \
+            dst.ATTR = src.ATTR;       \
+        }                              \
+    } while (0)
+
+    SCW_COPY_IF_SELECTED(event_id);
+    SCW_COPY_IF_SELECTED(parent_id);
+    SCW_COPY_IF_SELECTED(action_id);
+    SCW_COPY_IF_SELECTED(track_step_count);
+    SCW_COPY_IF_SELECTED(step_length);
+    SCW_COPY_IF_SELECTED(particle);
+    SCW_COPY_IF_SELECTED(energy_deposition);
+    for (auto sp : range(StepPoint::size_))
+    {
+        SCW_COPY_IF_SELECTED(points[sp].time);
+        SCW_COPY_IF_SELECTED(points[sp].pos);
+        SCW_COPY_IF_SELECTED(points[sp].dir);
+        SCW_COPY_IF_SELECTED(points[sp].volume_id);
+        SCW_COPY_IF_SELECTED(points[sp].energy);
+    }
+#undef SCW_COPY_IF_SELECTED
+
+    HostStepData ref;
+    ref = dst;
+    this->write(ref, state.stream_id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Gather columns and queue them for writing.
+ */
+void StepColumnWriter::write(HostStepData const& steps, StreamId stream)
+{
+    // Find the active track slots
+    std::vector<size_type> rows;
+    auto track_ids = steps.track_id[AllItems<TrackId, MemSpace::host>{}];
+    for (auto i : range(track_ids.size()))
+    {
+        if (track_ids[i])
+        {
+            rows.push_back(i);
+        }
+    }
+    if (rows.empty())
+    {
+        return;
+    }
+
+    StepColumnChunk chunk;
+    chunk.stream_id = stream;
+    chunk.num_rows = rows.size();
+
+    append_column("track_id", steps.track_id, rows, &chunk);
+#define SCW_APPEND_IF_SELECTED(ATTR)                          \
+    do                                                        \
+    {                                                         \
+        if (selection_.ATTR)                                  \
+        {                                                     \
+            append_column(#ATTR, steps.ATTR, rows, &chunk);   \
+        }                                                     \
+    } while (0)
+
+    SCW_APPEND_IF_SELECTED(event_id);
+    SCW_APPEND_IF_SELECTED(parent_id);
+    SCW_APPEND_IF_SELECTED(action_id);
+    SCW_APPEND_IF_SELECTED(track_step_count);
+    SCW_APPEND_IF_SELECTED(step_length);
+    SCW_APPEND_IF_SELECTED(particle);
+    SCW_APPEND_IF_SELECTED(energy_deposition);
+#undef SCW_APPEND_IF_SELECTED
+
+    for (auto sp : range(StepPoint::size_))
+    {
+        std::string prefix = (sp == StepPoint::pre ? "pre_" : "post_");
+        auto const& sel = selection_.points[sp];
+        auto const& point = steps.points[sp];
+#define SCW_APPEND_IF_SELECTED(ATTR)                                   \
+    do                                                                 \
+    {                                                                  \
+        if (sel.ATTR)                                                  \
+        {                                                              \
+            append_column(prefix + #ATTR, point.ATTR, rows, &chunk);   \
+        }                                                              \
+    } while (0)
+
+        SCW_APPEND_IF_SELECTED(time);
+        SCW_APPEND_IF_SELECTED(pos);
+        SCW_APPEND_IF_SELECTED(dir);
+        SCW_APPEND_IF_SELECTED(volume_id);
+        SCW_APPEND_IF_SELECTED(energy);
+#undef SCW_APPEND_IF_SELECTED
+    }
+
+    queue_.push(std::move(chunk));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all queued chunks to be written to the file.
+ */
+void StepColumnWriter::flush()
+{
+    queue_.wait();
+    out_.flush();
+    CELER_VALIDATE(out_, << "failed to write step column output");
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Check the magic string at the beginning of a step column file.
+ */
+bool read_step_column_header(std::istream& is)
+{
+    char buffer[magic_size];
+    is.read(buffer, magic_size);
+    return is && std::memcmp(buffer, magic_string, magic_size) == 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the next chunk from a step column file, returning false at the end.
+ */
+bool read_step_column_chunk(std::istream& is, StepColumnChunk* chunk)
+{
+    CELER_EXPECT(chunk);
+
+    std::uint32_t stream{};
+    if (!read_value(is, &stream))
+    {
+        // End of file
+        return false;
+    }
+    std::uint32_t num_rows{};
+    std::uint32_t num_columns{};
+    read_value(is, &num_rows);
+    read_value(is, &num_columns);
+    CELER_VALIDATE(is, << "truncated step column chunk header");
+
+    chunk->stream_id = StreamId{stream};
+    chunk->num_rows = num_rows;
+    chunk->columns.resize(num_columns);
+    for (StepColumn& col : chunk->columns)
+    {
+        std::uint8_t name_size{};
+        read_value(is, &name_size);
+        col.name.resize(name_size);
+        is.read(col.name.data(), name_size);
+        read_value(is, &col.type);
+        read_value(is, &col.type_size);
+        read_value(is, &col.width);
+        col.data.resize(std::size_t{num_rows} * col.width * col.type_size);
+        is.read(col.data.data(), col.data.size());
+        CELER_VALIDATE(is, << "truncated step column '" << col.name << "'");
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/StepColumnWriter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/WorkQueue.hh"
+
+#include "StepInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Values of a single step attribute for all steps in a chunk.
+ *
+ * The data is a contiguous array of \c width components per row, each with
+ * a size of \c type_size bytes. The type is \c 'u' for unsigned integers (IDs
+ * and counters, with invalid IDs stored as the maximum value) and \c 'f' for
+ * floating point values in native Celeritas units.
+ */
+struct StepColumn
+{
+    std::string name;
+    char type{};
+    std::uint8_t type_size{};
+    std::uint8_t width{};
+    std::vector<char> data;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step data from a single stream at a single step iteration.
+ */
+struct StepColumnChunk
+{
+    StreamId stream_id;
+    size_type num_rows{};
+    std::vector<StepColumn> columns;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write "MC truth" step data as column-oriented binary chunks.
+ *
+ * Each call to \c process_steps gathers the selected attributes of all active
+ * tracks directly from the step state collections into one contiguous array
+ * per attribute, and queues the chunk for a background thread to write. No
+ * per-step objects are created, and transport only waits on I/O when more
+ * than \c max_queued chunks are waiting to be written. The file is complete
+ * once \c flush is called or the writer is destroyed.
+ *
+ * The file is self-describing so it can be read without this class:
+ * \verbatim
+   file:   magic "CELSTEP1", then chunks until EOF
+   chunk:  u32 stream_id, u32 num_rows, u32 num_columns, then columns
+   column: u8 name_size, name, char type, u8 type_size, u8 width,
+           then num_rows * width * type_size bytes of data
+ * \endverbatim
+ * All integers are in native byte order. Column names match the \c StepData
+ * members, with \c pre_ and \c post_ prefixes for step point data.
+ *
+ * \note The chunks are not compressed since no compression library is a
+ * Celeritas dependency.
+ */
+class StepColumnWriter final : public StepInterface
+{
+  public:
+    // Construct with output filename and data selection
+    StepColumnWriter(std::string const& filename,
+                     StepSelection selection,
+                     size_type max_queued = 8);
+
+    // Write remaining chunks and close the file
+    ~StepColumnWriter();
+
+    //! Prevent copying and moving due to file ownership
+    CELER_DELETE_COPY_MOVE(StepColumnWriter);
+
+    // Gather step data on the host and queue it for writing
+    void process_steps(HostStepState) final;
+
+    // Copy step data to the host and queue it for writing
+    void process_steps(DeviceStepState) final;
+
+    // Wait for all queued chunks to be written to the file
+    void flush();
+
+    //! Selection of data to be stored
+    StepSelection selection() const final { return selection_; }
+
+    //! No detector filtering selection is implemented
+    Filters filters() const final { return {}; }
+
+  private:
+    using HostStepData = StepStateDataImpl<Ownership::reference, MemSpace::host>;
+
+    StepSelection selection_;
+    std::ofstream out_;
+    WorkQueue<StepColumnChunk> queue_;
+
+    // Gather columns and queue them for writing
+    void write(HostStepData const& steps, StreamId stream);
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Check the magic string at the beginning of a step column file
+bool read_step_column_header(std::istream& is);
+
+// Read the next chunk from a step column file, returning false at the end
+bool read_step_column_chunk(std::istream& is, StepColumnChunk* chunk);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <exception>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "corecel/Assert.hh"
@@ -14,6 +17,9 @@
 #include "corecel/sys/Device.hh"
 
 #include "ParamsDataInterface.hh"
+#include "ScopedSharedParams.hh"
+
+#include "detail/NodeSharedMemory.hh"
 
 namespace celeritas
 {
@@ -29,6 +35,16 @@ namespace celeritas
  * - Has a boolean operator returning whether it's in a valid state.
  *
  * On assignment, it will copy the data to the device if the GPU is enabled.
+ * If a \c ScopedSharedParams is active, the host data is moved into memory
+ * shared by all processes on the node.
+ *
+ * Large params should construct the mirror from a function that builds the
+ * host data. When sharing is active, only the first process on each node
+ * calls it, and the other processes map the shared result without ever
+ * building their own copy. The function must not make collective calls, since
+ * the other processes still call it if the data cannot be shared. If it
+ * throws on the first process, every process on the node throws rather than
+ * waiting for the shared data.
  *
  * Example:
  * \code
@@ -65,8 +81,14 @@ class CollectionMirror : public ParamsDataInterface<P>
     // Construct from host data
     explicit inline CollectionMirror(HostValue&& host);
 
+    // Construct from a function that builds host data
+    template<class F,
+             std::enable_if_t<std::is_invocable_r_v<HostVal<P>, F&>, bool>
+             = true>
+    explicit inline CollectionMirror(F&& build);
+
     //! Whether the data is assigned
-    explicit operator bool() const { return static_cast<bool>(host_); }
+    explicit operator bool() const { return static_cast<bool>(host_ref_); }
 
     //! Access data on host
     HostRef const& host_ref() const final { return host_ref_; }
@@ -78,16 +100,20 @@ class CollectionMirror : public ParamsDataInterface<P>
 
   private:
     HostValue host_;
+    std::shared_ptr<void const> shared_host_;
     HostRef host_ref_;
     P<Ownership::value, MemSpace::device> device_;
     DeviceRef device_ref_;
+
+    inline void share_host(MpiCommunicator const& comm);
+    inline void copy_to_device();
 };
 
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
 /*!
- * Construct with defaults.
+ * Construct from host data.
  */
 template<template<Ownership, MemSpace> class P>
 CollectionMirror<P>::CollectionMirror(HostValue&& host)
@@ -95,10 +121,103 @@ CollectionMirror<P>::CollectionMirror(HostValue&& host)
 {
     CELER_EXPECT(host_);
     host_ref_ = host_;
+    if (auto const* comm = ScopedSharedParams::node_comm())
+    {
+        this->share_host(*comm);
+    }
+    this->copy_to_device();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a function that builds host data.
+ *
+ * If sharing is active, only the first process on the node builds the data
+ * unless it is too small to share. The first process tells the others
+ * whether the build succeeded before any data is exchanged, so that an
+ * exception is raised on every process instead of leaving the others
+ * blocked in a collective call.
+ */
+template<template<Ownership, MemSpace> class P>
+template<class F,
+         std::enable_if_t<std::is_invocable_r_v<HostVal<P>, F&>, bool>>
+CollectionMirror<P>::CollectionMirror(F&& build)
+{
+    auto const* comm = ScopedSharedParams::node_comm();
+    if (!comm)
+    {
+        host_ = build();
+        CELER_ASSERT(host_);
+        host_ref_ = host_;
+        this->copy_to_device();
+        return;
+    }
+
+    bool const is_leader = comm->rank() == 0;
+    std::exception_ptr error;
+    if (is_leader)
+    {
+        try
+        {
+            host_ = build();
+            CELER_ASSERT(host_);
+            host_ref_ = host_;
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }
+    int failed = error ? 1 : 0;
+    broadcast(*comm, 0, Span<int, 1>{&failed, 1});
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    CELER_VALIDATE(!failed,
+                   << "failed to build shared params data on the first "
+                      "process of the node");
+
+    this->share_host(*comm);
+    if (!is_leader && !shared_host_)
+    {
+        // Data wasn't shared: build a local copy
+        host_ = build();
+        CELER_ASSERT(host_);
+        host_ref_ = host_;
+    }
+    this->copy_to_device();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move the host data into memory shared by processes on the node.
+ */
+template<template<Ownership, MemSpace> class P>
+void CollectionMirror<P>::share_host(MpiCommunicator const& comm)
+{
+    shared_host_ = detail::share_host_data<P>(comm,
+                                              ScopedSharedParams::min_bytes,
+                                              host_ ? &host_ : nullptr,
+                                              &host_ref_);
+    if (shared_host_)
+    {
+        // Release the local copy in favor of the node-shared one
+        host_ = {};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy data to device and save reference.
+ */
+template<template<Ownership, MemSpace> class P>
+void CollectionMirror<P>::copy_to_device()
+{
+    CELER_EXPECT(host_ref_);
     if (celeritas::device())
     {
-        // Copy data to device and save reference
-        device_ = host_;
+        device_ = host_ref_;
         device_ref_ = device_;
     }
 }
@@ -0,0 +1,194 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/DataCache.cc
+//---------------------------------------------------------------------------//
+#include "DataCache.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string_view>
+
+#include "corecel/Version.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/HashUtils.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! File header for checking compatibility
+struct CacheHeader
+{
+    char magic[8];
+    std::uint64_t format;
+    std::uint64_t key;
+};
+
+//! Identifying bytes at the start of each file
+constexpr char cache_magic[8] = {'C', 'E', 'L', 'E', 'R', 'D', 'C', '\0'};
+//! Increment when the file layout changes
+constexpr std::uint64_t cache_format = 1;
+
+//---------------------------------------------------------------------------//
+//! Combine the user key with the build configuration
+std::uint64_t full_key(std::size_t key)
+{
+    return hash_combine(key,
+                        std::string_view{celeritas_version},
+                        sizeof(real_type),
+                        sizeof(size_type));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with filename and input hash.
+ */
+DataCacheWriter::DataCacheWriter(std::string filename, std::size_t key)
+    : filename_{std::move(filename)}
+{
+    CELER_EXPECT(!filename_.empty());
+
+    // Use a unique temporary name so that concurrent writers don't collide
+    temp_filename_ = filename_ + ".tmp"
+                     + std::to_string(std::random_device{}());
+    os_.open(temp_filename_, std::ios::out | std::ios::binary);
+    CELER_VALIDATE(os_,
+                   << "failed to open cache file '" << temp_filename_
+                   << "' for writing");
+
+    CacheHeader header;
+    std::copy(std::begin(cache_magic), std::end(cache_magic), header.magic);
+    header.format = cache_format;
+    header.key = full_key(key);
+    os_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove the temporary file if not successfully finalized.
+ *
+ * This discards partially written data if an exception was thrown while
+ * writing or while flushing and renaming the file.
+ */
+DataCacheWriter::~DataCacheWriter()
+{
+    if (!temp_filename_.empty())
+    {
+        os_.close();
+        std::remove(temp_filename_.c_str());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Flush and move the file into place.
+ */
+void DataCacheWriter::finalize()
+{
+    CELER_EXPECT(os_.is_open());
+    os_.close();
+    CELER_VALIDATE(os_,
+                   << "failed to write cache file '" << temp_filename_
+                   << "'");
+    int result = std::rename(temp_filename_.c_str(), filename_.c_str());
+    CELER_VALIDATE(result == 0,
+                   << "failed to move cache file '" << temp_filename_
+                   << "' to '" << filename_ << "'");
+    temp_filename_.clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a block of data.
+ */
+void DataCacheWriter::write(std::size_t elem_size, Span<std::byte const> data)
+{
+    CELER_EXPECT(os_.is_open());
+    std::uint64_t sizes[] = {elem_size, data.size()};
+    os_.write(reinterpret_cast<char const*>(sizes), sizeof(sizes));
+    os_.write(reinterpret_cast<char const*>(data.data()), data.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with filename and input hash.
+ */
+DataCacheReader::DataCacheReader(std::string const& filename, std::size_t key)
+    : is_{filename, std::ios::in | std::ios::binary}
+{
+    if (!is_)
+    {
+        CELER_LOG(debug) << "No cache file at '" << filename << "'";
+        return;
+    }
+
+    is_.seekg(0, std::ios::end);
+    file_size_ = is_.tellg();
+    is_.seekg(0, std::ios::beg);
+
+    CacheHeader header;
+    is_.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!is_
+        || !std::equal(
+            std::begin(cache_magic), std::end(cache_magic), header.magic)
+        || header.format != cache_format || header.key != full_key(key))
+    {
+        CELER_LOG(warning) << "Ignoring incompatible cache file '" << filename
+                           << "'";
+        is_.setstate(std::ios::failbit);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Check that the whole file was consumed.
+ */
+bool DataCacheReader::finalize()
+{
+    if (*this)
+    {
+        // Reading past the end should fail
+        is_.peek();
+        return is_.eof();
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the size of the next block and check the element size.
+ */
+std::size_t DataCacheReader::read_size(std::size_t elem_size)
+{
+    std::uint64_t sizes[2] = {0, 0};
+    is_.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+    if (!is_)
+        return 0;
+    if (sizes[0] != elem_size || sizes[1] % elem_size != 0
+        || static_cast<std::streamoff>(sizes[1]) > file_size_ - is_.tellg())
+    {
+        is_.setstate(std::ios::failbit);
+    }
+    return sizes[1];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a block of data.
+ */
+void DataCacheReader::read(Span<std::byte> data)
+{
+    is_.read(reinterpret_cast<char*>(data.data()), data.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
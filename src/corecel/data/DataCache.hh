@@ -0,0 +1,214 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/DataCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+#include "Collection.hh"
+#include "CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write host collections to a binary cache file.
+ *
+ * The cache is a flat binary file with a header containing a format version
+ * and a key. The key should be a hash of all the inputs used to build the
+ * data; the Celeritas version string and floating point precision are
+ * combined into it automatically. Each collection is stored as its element
+ * size, its number of elements, and the raw bytes, so only trivially copyable
+ * element types are supported.
+ *
+ * The data is written to a temporary file that is renamed when the writer is
+ * finalized, so that concurrent jobs sharing a cache directory never read a
+ * partially written file.
+ *
+ * \todo Only the physics tables in \c PhysicsParams are cached so far. Other
+ * expensive setup data should be added: the ORANGE BIH trees, the
+ * Seltzer-Berger tables and envelopes, and the bremsstrahlung element
+ * selector grids.
+ *
+ * \code
+    DataCacheWriter write_cache(filename, key);
+    write_cache(data.reals);
+    write_cache(data.grids);
+    write_cache.finalize();
+   \endcode
+ */
+class DataCacheWriter
+{
+  public:
+    // Construct with filename and input hash
+    DataCacheWriter(std::string filename, std::size_t key);
+
+    // Remove the temporary file if not successfully finalized
+    ~DataCacheWriter();
+
+    //!@{
+    //! Prevent copying and moving
+    DataCacheWriter(DataCacheWriter const&) = delete;
+    DataCacheWriter& operator=(DataCacheWriter const&) = delete;
+    //!@}
+
+    // Write a collection
+    template<class T, class I>
+    inline void
+    operator()(Collection<T, Ownership::value, MemSpace::host, I> const&);
+
+    // Write a trivially copyable value
+    template<class T>
+    inline void operator()(T const& value);
+
+    // Flush and move the file into place
+    void finalize();
+
+  private:
+    std::string filename_;
+    std::string temp_filename_;
+    std::ofstream os_;
+
+    void write(std::size_t elem_size, Span<std::byte const> data);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read host collections from a binary cache file.
+ *
+ * The reader is "false" if the file is missing or was written with a
+ * different key, format, or Celeritas version. Read operations must be in the
+ * same order and with the same types as the corresponding writes: a mismatch
+ * (or a truncated file) makes the reader "false", after which the data being
+ * read in should be discarded. Collections are read straight into their
+ * storage, without an intermediate buffer.
+ *
+ * \code
+    DataCacheReader read_cache(filename, key);
+    if (read_cache)
+    {
+        read_cache(&data.reals);
+        read_cache(&data.grids);
+    }
+    if (read_cache.finalize())
+    {
+        // All data was read successfully
+    }
+   \endcode
+ */
+class DataCacheReader
+{
+  public:
+    // Construct with filename and input hash
+    DataCacheReader(std::string const& filename, std::size_t key);
+
+    // Read a collection
+    template<class T, class I>
+    inline void operator()(Collection<T, Ownership::value, MemSpace::host, I>*);
+
+    // Read a trivially copyable value
+    template<class T>
+    inline void operator()(T* value);
+
+    // Check that the whole file was consumed
+    bool finalize();
+
+    //! Whether all reads have succeeded
+    explicit operator bool() const { return static_cast<bool>(is_); }
+
+  private:
+    std::ifstream is_;
+    std::streamoff file_size_{0};
+
+    std::size_t read_size(std::size_t elem_size);
+    void read(Span<std::byte> data);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Write a collection.
+ */
+template<class T, class I>
+void DataCacheWriter::operator()(
+    Collection<T, Ownership::value, MemSpace::host, I> const& c)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "cached data must be trivially copyable");
+    auto items = c[AllItems<T, MemSpace::host>{}];
+    this->write(sizeof(T),
+                {reinterpret_cast<std::byte const*>(items.data()),
+                 items.size() * sizeof(T)});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a single trivially copyable value.
+ */
+template<class T>
+void DataCacheWriter::operator()(T const& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "cached data must be trivially copyable");
+    this->write(sizeof(T),
+                {reinterpret_cast<std::byte const*>(&value), sizeof(T)});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a collection, replacing its contents.
+ *
+ * The data is read directly into the collection's storage.
+ */
+template<class T, class I>
+void DataCacheReader::operator()(
+    Collection<T, Ownership::value, MemSpace::host, I>* c)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "cached data must be trivially copyable");
+    CELER_EXPECT(c);
+    std::size_t size = this->read_size(sizeof(T));
+    if (!*this)
+        return;
+
+    *c = {};
+    resize(c, size / sizeof(T));
+    auto items = (*c)[AllItems<T, MemSpace::host>{}];
+    this->read({reinterpret_cast<std::byte*>(items.data()), size});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a single trivially copyable value.
+ */
+template<class T>
+void DataCacheReader::operator()(T* value)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "cached data must be trivially copyable");
+    CELER_EXPECT(value);
+    std::size_t size = this->read_size(sizeof(T));
+    if (*this && size != sizeof(T))
+    {
+        is_.setstate(std::ios::failbit);
+    }
+    if (!*this)
+        return;
+
+    this->read({reinterpret_cast<std::byte*>(value), sizeof(T)});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,164 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/HugePageAllocator.cc
+//---------------------------------------------------------------------------//
+#include "HugePageAllocator.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+#include "corecel/Macros.hh"
+#include "corecel/sys/Environment.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+constexpr std::size_t huge_page_size = HugePageAllocator<char>::huge_page_size;
+
+//---------------------------------------------------------------------------//
+thread_local HostAllocationHook* active_hook{nullptr};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the alignment used for an allocation.
+ */
+std::size_t
+effective_alignment(std::size_t bytes, std::size_t align, bool huge)
+{
+    if (huge && bytes >= huge_page_size)
+    {
+        return std::max(align, huge_page_size);
+    }
+    return align;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access the huge page setting, initialized from the environment.
+ */
+std::atomic<bool>& huge_page_setting()
+{
+    static std::atomic<bool> result{
+        getenv_flag("CELER_HUGE_PAGES", false).value};
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Install an allocation hook on this thread, returning the previous one.
+ *
+ * Passing null removes the hook.
+ */
+HostAllocationHook* exchange_host_allocation_hook(HostAllocationHook* hook)
+{
+    return std::exchange(active_hook, hook);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate aligned host memory, optionally using huge pages.
+ *
+ * Memory is aligned to at least \c align , using the aligned
+ * \c ::operator new only when the type is over-aligned. If huge pages are
+ * requested and the allocation is large, the memory is aligned to a huge page
+ * boundary and advised to use transparent huge pages. The advice is only a
+ * hint: if transparent huge pages are disabled or unavailable, the kernel
+ * silently uses regular pages. If an allocation hook is installed on this
+ * thread, it may provide the memory instead.
+ */
+void* allocate_host_pages(std::size_t bytes, std::size_t align, bool huge)
+{
+    if (CELER_UNLIKELY(active_hook))
+    {
+        if (void* p = active_hook->allocate(bytes, align))
+        {
+            return p;
+        }
+    }
+
+    align = effective_alignment(bytes, align, huge);
+    if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        return ::operator new(bytes);
+    }
+
+    void* p = ::operator new(bytes, std::align_val_t{align});
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (align >= huge_page_size)
+    {
+        ::madvise(p, bytes, MADV_HUGEPAGE);
+    }
+#endif
+    return p;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free memory from allocate_host_pages.
+ *
+ * The arguments must be the same as the ones used to allocate.
+ */
+void deallocate_host_pages(void* p,
+                           std::size_t bytes,
+                           std::size_t align,
+                           bool huge) noexcept
+{
+    if (CELER_UNLIKELY(active_hook) && active_hook->deallocate(p))
+    {
+        return;
+    }
+
+    align = effective_alignment(bytes, align, huge);
+    if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        ::operator delete(p);
+    }
+    else
+    {
+        ::operator delete(p, std::align_val_t{align});
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether new host collections request huge pages.
+ *
+ * This is disabled by default and can be enabled with the
+ * \c CELER_HUGE_PAGES environment variable.
+ */
+bool huge_pages_enabled()
+{
+    return detail::huge_page_setting().load(std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set whether host collections created later request huge pages.
+ *
+ * Existing collections keep the policy they were created with.
+ */
+void enable_huge_pages(bool enabled)
+{
+    detail::huge_page_setting().store(enabled, std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,163 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/HugePageAllocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Thread-local override of the memory used by host collections.
+ *
+ * When a hook is installed on a thread, host collection allocations on that
+ * thread are first offered to it. This lets specialized code (such as
+ * building params in node-shared memory) redirect allocations without the
+ * allocator knowing about it.
+ */
+class HostAllocationHook
+{
+  public:
+    // Get memory, or return null to use the default allocation
+    virtual void* allocate(std::size_t bytes, std::size_t align) = 0;
+
+    // Release memory if it came from this hook, returning whether it did
+    virtual bool deallocate(void* p) noexcept = 0;
+
+  protected:
+    ~HostAllocationHook() = default;
+};
+
+// Install an allocation hook on this thread, returning the previous one
+HostAllocationHook* exchange_host_allocation_hook(HostAllocationHook* hook);
+
+//---------------------------------------------------------------------------//
+// Allocate aligned host memory, optionally using huge pages
+void* allocate_host_pages(std::size_t bytes, std::size_t align, bool huge);
+
+// Free memory from allocate_host_pages
+void deallocate_host_pages(void* p,
+                           std::size_t bytes,
+                           std::size_t align,
+                           bool huge) noexcept;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// Whether new host collections request huge pages
+bool huge_pages_enabled();
+
+// Set whether host collections created later request huge pages
+void enable_huge_pages(bool enabled);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate host memory, optionally backed by transparent huge pages.
+ *
+ * Satisfies the Allocator named requirement. Memory is always aligned to at
+ * least \c alignof(T) .
+ *
+ * Huge pages are opt-in: they are requested only if \c huge_pages_enabled
+ * was true when the allocator was constructed, which by default is set by the
+ * \c CELER_HUGE_PAGES environment variable. In that case, allocations of at
+ * least \c huge_page_size bytes are aligned to a huge page boundary and, on
+ * Linux, advised to use transparent huge pages, which reduces TLB misses when
+ * sweeping over large state and params arrays. Otherwise this allocator
+ * behaves like \c std::allocator . The policy is part of the allocator state
+ * so that memory is always freed the same way it was allocated.
+ *
+ * NUMA placement relies only on the operating system's first-touch policy:
+ * no memory is explicitly bound to a node (e.g., with \c mbind ), and the
+ * memory is not touched here. Since Linux places each page on the NUMA node
+ * of the thread that first writes it, value-initializing a collection on the
+ * thread that owns it (as each stream does when building its state) keeps
+ * the state local to that thread's socket as long as the thread is not
+ * migrated to another socket later.
+ */
+template<class T>
+struct HugePageAllocator
+{
+    using value_type = T;
+
+    //! Minimum allocation size to request huge pages
+    static constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+    //! Transfer the allocation policy along with the memory
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    //! Construct with the current huge page setting
+    HugePageAllocator() : huge_pages{huge_pages_enabled()} {}
+
+    //! Construct with an explicit huge page setting
+    explicit HugePageAllocator(bool use_huge_pages) noexcept
+        : huge_pages{use_huge_pages}
+    {
+    }
+
+    //! Rebind with the same policy
+    template<class U>
+    HugePageAllocator(HugePageAllocator<U> const& other) noexcept
+        : huge_pages{other.huge_pages}
+    {
+    }
+
+    [[nodiscard]] inline T* allocate(std::size_t);
+
+    inline void deallocate(T*, std::size_t) noexcept;
+
+    //! Whether large allocations request huge pages
+    bool huge_pages{false};
+};
+
+template<class T, class U>
+bool operator==(HugePageAllocator<T> const& a, HugePageAllocator<U> const& b)
+{
+    return a.huge_pages == b.huge_pages;
+}
+
+template<class T, class U>
+bool operator!=(HugePageAllocator<T> const& a, HugePageAllocator<U> const& b)
+{
+    return !(a == b);
+}
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate space for \c n objects.
+ */
+template<class T>
+T* HugePageAllocator<T>::allocate(std::size_t n)
+{
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_array_new_length();
+
+    return static_cast<T*>(
+        detail::allocate_host_pages(n * sizeof(T), alignof(T), huge_pages));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free allocated memory.
+ */
+template<class T>
+void HugePageAllocator<T>::deallocate(T* p, std::size_t n) noexcept
+{
+    detail::deallocate_host_pages(p, n * sizeof(T), alignof(T), huge_pages);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/ScopedSharedParams.cc
+//---------------------------------------------------------------------------//
+#include "ScopedSharedParams.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Params built on other threads (e.g., Geant4 workers) are never shared
+thread_local ScopedSharedParams const* active_sharing{nullptr};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Share among the processes of the communicator on each node.
+ */
+ScopedSharedParams::ScopedSharedParams(MpiCommunicator const& comm)
+    : node_comm_{MpiCommunicator::comm_shared(comm)}, prev_{active_sharing}
+{
+    CELER_ASSERT(node_comm_);
+    if (node_comm_->size() > 1)
+    {
+        CELER_LOG(debug) << "Sharing params data among " << node_comm_->size()
+                         << " processes per node";
+    }
+    active_sharing = this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop sharing.
+ */
+ScopedSharedParams::~ScopedSharedParams()
+{
+    active_sharing = prev_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the communicator sharing params on this thread, or null if inactive.
+ */
+MpiCommunicator const* ScopedSharedParams::node_comm()
+{
+    if (!active_sharing || active_sharing->node_comm_->size() <= 1)
+    {
+        return nullptr;
+    }
+    return active_sharing->node_comm_.get();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/ScopedSharedParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "corecel/Macros.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Share host params data among the processes on each node while in scope.
+ *
+ * Each \c CollectionMirror constructed while this is active moves its host
+ * data into a read-only POSIX shared memory segment that is mapped by every
+ * process on the node, and releases the process-local copy. With many MPI
+ * ranks per node, this leaves a single copy of large params data (physics
+ * tables, geometry, cross section grids) per node rather than per rank.
+ *
+ * All processes in the communicator must construct the same params in the
+ * same order while this is in scope, since sharing is collective. Params
+ * whose mirror is constructed from a build function are built only by the
+ * first process on each node. Params data smaller than \c min_bytes is left
+ * in local memory. Data is never shared if the communicator is null or if
+ * each node has only one process. The node communicator is freed when this
+ * goes out of scope.
+ *
+ * Sharing only applies to the thread that constructs this object: params
+ * built concurrently on other threads keep local copies, so that they never
+ * make collective calls out of order.
+ *
+ * \code
+    {
+        ScopedSharedParams share_params(MpiCommunicator::comm_world());
+        params = std::make_shared<CoreParams>(std::move(input));
+    }
+   \endcode
+ */
+class ScopedSharedParams
+{
+  public:
+    //! Minimum size of params data to share
+    static constexpr std::size_t min_bytes = std::size_t(1) << 20;
+
+    // Share among the processes of the communicator on each node
+    explicit ScopedSharedParams(MpiCommunicator const& comm);
+
+    // Stop sharing
+    ~ScopedSharedParams();
+
+    //! Prevent copying and moving for RAII class
+    CELER_DELETE_COPY_MOVE(ScopedSharedParams);
+
+    // Get the communicator sharing params on this thread, or null if inactive
+    static MpiCommunicator const* node_comm();
+
+  private:
+    std::shared_ptr<MpiCommunicator const> node_comm_;
+    ScopedSharedParams const* prev_{nullptr};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -24,6 +24,7 @@
 #include "DisabledStorage.hh"
 #include "TypeTraits.hh"
 #include "../Copier.hh"
+#include "../HugePageAllocator.hh"
 #include "../LdgIterator.hh"
 #include "../PinnedAllocator.hh"
 
@@ -124,7 +125,7 @@ struct CollectionStorage<T, Ownership::value, MemSpace::host>
     // compiling in CUDA
     using type = DisabledStorage<T>;
 #else
-    using type = std::vector<T>;
+    using type = std::vector<T, HugePageAllocator<T>>;
 #endif
     type data;
 
@@ -0,0 +1,178 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/NodeSharedMemory.cc
+//---------------------------------------------------------------------------//
+#include "NodeSharedMemory.hh"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define CELER_NODE_SHARED_MMAP 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#else
+#    define CELER_NODE_SHARED_MMAP 0
+#endif
+#include <cstdint>
+#include <exception>
+#include <string>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get a unique segment name from the creating process and a counter.
+ */
+std::string segment_name(unsigned long long pid, unsigned long long index)
+{
+    return "/celeritas-" + std::to_string(pid) + "-" + std::to_string(index);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a read-only segment mapped at the same address on all processes.
+ *
+ * The first process in the communicator creates the POSIX shared memory
+ * object, fills it, and makes it read-only. The others map it using the
+ * first process's address as a hint. If the segment can't be filled or the
+ * address is unavailable in any process, all of them release the segment and
+ * a null pointer is returned.
+ * The shared memory object is unlinked as soon as it is mapped, so it is
+ * released by the operating system when the last process unmaps it, even if
+ * the run aborts.
+ */
+std::shared_ptr<void const> map_node_shared(MpiCommunicator const& comm,
+                                            std::size_t bytes,
+                                            SharedSegmentFiller const& fill)
+{
+    CELER_EXPECT(bytes > 0);
+    CELER_EXPECT(fill);
+
+#if CELER_NODE_SHARED_MMAP
+    // Address, creating process ID, and segment index
+    unsigned long long info[3] = {0, 0, 0};
+    void* addr = MAP_FAILED;
+    std::string name;
+
+    if (comm.rank() == 0)
+    {
+        static unsigned long long num_segments = 0;
+        info[1] = static_cast<unsigned long long>(::getpid());
+        info[2] = num_segments++;
+        name = segment_name(info[1], info[2]);
+
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd >= 0)
+        {
+            if (::ftruncate(fd, static_cast<off_t>(bytes)) == 0)
+            {
+                addr = ::mmap(nullptr,
+                              bytes,
+                              PROT_READ | PROT_WRITE,
+                              MAP_SHARED,
+                              fd,
+                              0);
+            }
+            ::close(fd);
+        }
+        if (addr == MAP_FAILED)
+        {
+            CELER_LOG_LOCAL(warning)
+                << "Failed to create shared memory segment '" << name
+                << "' of " << bytes << " bytes";
+        }
+        else
+        {
+            try
+            {
+                fill(Span<char>{static_cast<char*>(addr), bytes});
+            }
+            catch (std::exception const& e)
+            {
+                // Don't throw before the other processes get the status
+                CELER_LOG_LOCAL(warning)
+                    << "Failed to fill shared memory segment '" << name
+                    << "': " << e.what();
+                ::munmap(addr, bytes);
+                addr = MAP_FAILED;
+            }
+        }
+        if (addr != MAP_FAILED)
+        {
+            ::mprotect(addr, bytes, PROT_READ);
+            info[0] = reinterpret_cast<std::uintptr_t>(addr);
+        }
+        else
+        {
+            ::shm_unlink(name.c_str());
+        }
+    }
+
+    broadcast(comm, 0, make_span(info));
+    if (info[0] == 0)
+    {
+        return {};
+    }
+
+    void* const expected = reinterpret_cast<void*>(info[0]);
+    if (comm.rank() != 0)
+    {
+        name = segment_name(info[1], info[2]);
+        int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd >= 0)
+        {
+            addr = ::mmap(expected, bytes, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+        }
+        if (addr != MAP_FAILED && addr != expected)
+        {
+            ::munmap(addr, bytes);
+            addr = MAP_FAILED;
+        }
+    }
+
+    int const mapped
+        = allreduce(comm, Operation::min, addr != MAP_FAILED ? 1 : 0);
+    if (comm.rank() == 0)
+    {
+        // All processes have opened the segment (or failed to)
+        ::shm_unlink(name.c_str());
+    }
+    if (!mapped)
+    {
+        CELER_LOG(warning) << "Failed to map shared memory segment at the "
+                              "same address on all processes: using a "
+                              "separate copy of the data on each";
+        if (addr != MAP_FAILED)
+        {
+            ::munmap(addr, bytes);
+        }
+        return {};
+    }
+
+    CELER_LOG(debug) << "Shared " << bytes << " bytes of host data among "
+                     << comm.size() << " processes";
+    return std::shared_ptr<void const>(addr, [bytes](void const* p) {
+        ::munmap(const_cast<void*>(p), bytes);
+    });
+#else
+    CELER_DISCARD(comm);
+    return {};
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/NodeSharedMemory.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
+
+#include "ScopedHostArena.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Function that writes the contents of a new shared segment
+using SharedSegmentFiller = std::function<void(Span<char>)>;
+
+//---------------------------------------------------------------------------//
+// Create a read-only segment mapped at the same address on all processes
+std::shared_ptr<void const> map_node_shared(MpiCommunicator const& comm,
+                                            std::size_t bytes,
+                                            SharedSegmentFiller const& fill);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy host data into a segment shared by all processes on the node.
+ *
+ * This must be called collectively by all processes in the node communicator.
+ * Only the first process needs the data (\c local may be null on the
+ * others): it measures the data and copies it into the segment, and the
+ * resulting reference (which points into the segment) is copied verbatim to
+ * the others. Since the segment is mapped at the same address everywhere, the
+ * reference is valid in every process. Measuring reuses a scratch block the
+ * size of the largest collection rather than making a full copy.
+ *
+ * The result keeps the segment mapped. It is null (and the reference is
+ * unchanged) if the data is smaller than \c min_bytes or if the segment could
+ * not be measured, filled, or mapped at the same address in every process.
+ * Errors on the first process are caught so that all processes take the same
+ * path through the collective calls.
+ */
+template<template<Ownership, MemSpace> class P>
+std::shared_ptr<void const> share_host_data(MpiCommunicator const& comm,
+                                            std::size_t min_bytes,
+                                            HostVal<P> const* local,
+                                            HostCRef<P>* ref)
+{
+    using RefT = HostCRef<P>;
+    static_assert(std::is_trivially_copyable_v<RefT>,
+                  "host references must be trivially copyable to be shared");
+    CELER_EXPECT(comm.rank() != 0 || local);
+    CELER_EXPECT(ref);
+
+    constexpr std::size_t alignment = ScopedHostArena::alignment;
+    constexpr std::size_t header_size = (sizeof(RefT) + alignment - 1)
+                                        / alignment * alignment;
+
+    // Measure the space needed by a copy of the data
+    unsigned long long bytes = 0;
+    if (comm.rank() == 0)
+    {
+        try
+        {
+            ScopedHostArena measure;
+            HostVal<P> temp;
+            temp = *local;
+            bytes = header_size + measure.size();
+        }
+        catch (std::exception const& e)
+        {
+            CELER_LOG_LOCAL(warning)
+                << "Failed to measure host data for sharing: " << e.what();
+            bytes = 0;
+        }
+    }
+    broadcast(comm, 0, Span<unsigned long long, 1>{&bytes, 1});
+    if (bytes < min_bytes)
+    {
+        return {};
+    }
+
+    auto segment = map_node_shared(comm, bytes, [&](Span<char> buffer) {
+        // Copy the data into the segment, followed by a reference to it
+        ScopedHostArena arena(buffer.subspan(header_size));
+        HostVal<P> shared;
+        shared = *local;
+        RefT shared_ref;
+        shared_ref = shared;
+        std::memcpy(buffer.data(), &shared_ref, sizeof(RefT));
+    });
+    if (segment)
+    {
+        std::memcpy(static_cast<void*>(ref), segment.get(), sizeof(RefT));
+    }
+    return segment;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/ScopedHostArena.cc
+//---------------------------------------------------------------------------//
+#include "ScopedHostArena.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Measure allocations.
+ */
+ScopedHostArena::ScopedHostArena()
+{
+    prev_ = exchange_host_allocation_hook(this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate sequentially from a buffer.
+ */
+ScopedHostArena::ScopedHostArena(Span<char> buffer) : buffer_{buffer}
+{
+    CELER_EXPECT(!buffer_.empty());
+    prev_ = exchange_host_allocation_hook(this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the previous arena.
+ */
+ScopedHostArena::~ScopedHostArena()
+{
+    exchange_host_allocation_hook(prev_);
+    for (auto const& s : scratch_)
+    {
+        ::operator delete(s.data, std::align_val_t{s.align});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate from the buffer or scratch space.
+ */
+void* ScopedHostArena::allocate(std::size_t bytes, std::size_t align)
+{
+    align = std::max(align, alignment);
+    std::size_t const start = (size_ + align - 1) / align * align;
+    std::size_t const stop = (start + bytes + alignment - 1) / alignment
+                             * alignment;
+    void* result = nullptr;
+    if (!buffer_.empty())
+    {
+        if (stop > buffer_.size())
+        {
+            throw std::bad_alloc();
+        }
+        result = buffer_.data() + start;
+        CELER_ASSERT(reinterpret_cast<std::uintptr_t>(result) % align == 0);
+    }
+    else
+    {
+        result = this->allocate_scratch(bytes, align);
+    }
+    size_ = stop;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Ignore deallocation of memory owned by this arena.
+ *
+ * The arena's memory is released all at once when the arena (or the buffer it
+ * allocates from) is destroyed.
+ */
+bool ScopedHostArena::deallocate(void* p) noexcept
+{
+    return this->owns(p);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the pointer was allocated by this arena.
+ */
+bool ScopedHostArena::owns(void const* p) const
+{
+    if (!buffer_.empty())
+    {
+        return p >= buffer_.data() && p < buffer_.data() + buffer_.size();
+    }
+    return std::any_of(scratch_.begin(),
+                       scratch_.end(),
+                       [p](Scratch const& s) { return s.data == p; });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get scratch space for a measured allocation.
+ *
+ * Blocks that are replaced by larger ones are kept until the arena is
+ * destroyed, since the measured data may still refer to them.
+ */
+void* ScopedHostArena::allocate_scratch(std::size_t bytes, std::size_t align)
+{
+    if (scratch_.empty() || scratch_.back().size < bytes
+        || scratch_.back().align < align)
+    {
+        Scratch s;
+        s.size = std::max(bytes, scratch_.empty() ? 0 : scratch_.back().size);
+        s.align = std::max(align,
+                           scratch_.empty() ? alignment : scratch_.back().align);
+        s.data = ::operator new(std::max(s.size, std::size_t(1)),
+                                std::align_val_t{s.align});
+        scratch_.push_back(s);
+    }
+    return scratch_.back().data;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/ScopedHostArena.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+
+#include "../HugePageAllocator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Redirect host collection allocations on this thread while in scope.
+ *
+ * The arena installs itself as the thread's \c HostAllocationHook , so it only
+ * affects code that constructs one (i.e., sharing params among processes).
+ *
+ * In "measure" mode, the padded sizes of allocations are accumulated, but
+ * every allocation returns the start of a single reusable scratch block that
+ * is only as large as the largest allocation. Measuring a copy of host data
+ * therefore costs only as much memory as its largest collection, but the
+ * measured copy is garbage and must only be destroyed.
+ *
+ * With a buffer, allocations are carved sequentially from it and
+ * deallocation is a null-op. Each allocation starts at an offset that is a
+ * multiple of its alignment (and of \c alignment ), so the buffer itself must
+ * be aligned to the largest alignment requested. Performing the same sequence
+ * of allocations in both modes (e.g., copying the same host data) therefore
+ * fits exactly into a buffer of the measured size.
+ */
+class ScopedHostArena final : public HostAllocationHook
+{
+  public:
+    //! Minimum alignment of each allocation
+    static constexpr std::size_t alignment = 64;
+
+    // Measure allocations
+    ScopedHostArena();
+
+    // Allocate sequentially from a buffer
+    explicit ScopedHostArena(Span<char> buffer);
+
+    // Restore the previous arena
+    ~ScopedHostArena();
+
+    //! Prevent copying and moving for RAII class
+    CELER_DELETE_COPY_MOVE(ScopedHostArena);
+
+    //! Number of bytes allocated, including padding
+    std::size_t size() const { return size_; }
+
+    // Allocate from the buffer or scratch space
+    void* allocate(std::size_t bytes, std::size_t align) final;
+
+    // Ignore deallocation of memory owned by this arena
+    bool deallocate(void* p) noexcept final;
+
+    // Whether the pointer was allocated by this arena
+    bool owns(void const* p) const;
+
+  private:
+    struct Scratch
+    {
+        void* data{nullptr};
+        std::size_t size{0};
+        std::size_t align{0};
+    };
+
+    Span<char> buffer_;
+    std::size_t size_{0};
+    std::vector<Scratch> scratch_;
+    HostAllocationHook* prev_{nullptr};
+
+    void* allocate_scratch(std::size_t bytes, std::size_t align);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -25,6 +25,43 @@ MpiCommunicator MpiCommunicator::comm_default()
     return comm_world();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a communicator of the processes that can share memory.
+ *
+ * The given communicator is split by node, so that the result contains only
+ * the processes that can share a memory segment with this one. A null
+ * communicator is returned for a null input. The new communicator is freed
+ * when the last reference to the result is released (unless MPI has already
+ * been finalized).
+ */
+auto MpiCommunicator::comm_shared(MpiCommunicator const& comm)
+    -> SPConstMpiCommunicator
+{
+    if (!comm)
+        return std::make_shared<MpiCommunicator const>();
+
+    MpiComm shared = detail::mpi_comm_null();
+    CELER_MPI_CALL(MPI_Comm_split_type(comm.mpi_comm(),
+                                       MPI_COMM_TYPE_SHARED,
+                                       comm.rank(),
+                                       MPI_INFO_NULL,
+                                       &shared));
+    return SPConstMpiCommunicator(
+        new MpiCommunicator{shared}, [](MpiCommunicator const* c) {
+            MpiComm to_free = c->mpi_comm();
+            delete c;
+#if CELERITAS_USE_MPI
+            if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized)
+            {
+                MPI_Comm_free(&to_free);
+            }
+#else
+            CELER_DISCARD(to_free);
+#endif
+        });
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with a native MPI communicator.
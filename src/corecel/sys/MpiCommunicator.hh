@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
+
 #include "MpiCommunicator.hh"
 
 #include "detail/MpiCommunicatorImpl.hh"
@@ -30,6 +32,7 @@ class MpiCommunicator
     //!@{
     //! \name Type aliases
     using MpiComm = detail::MpiComm;
+    using SPConstMpiCommunicator = std::shared_ptr<MpiCommunicator const>;
     //!@}
 
   public:
@@ -42,6 +45,9 @@ class MpiCommunicator
     // Construct a communicator with MPI_COMM_WORLD or null if disabled
     static MpiCommunicator comm_default();
 
+    // Construct a communicator of the processes that can share memory
+    static SPConstMpiCommunicator comm_shared(MpiCommunicator const& comm);
+
     //// CONSTRUCTORS ////
 
     // Construct with a null communicator (MPI is disabled)
@@ -64,6 +64,12 @@ allreduce(MpiCommunicator const& comm, Operation op, Span<T, N> data);
 template<class T, std::enable_if_t<std::is_fundamental<T>::value, bool> = true>
 inline T allreduce(MpiCommunicator const& comm, Operation op, T const src);
 
+//---------------------------------------------------------------------------//
+// Copy data from the root process to all others
+template<class T, std::size_t N>
+inline void
+broadcast(MpiCommunicator const& comm, int root, Span<T, N> data);
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -156,5 +162,25 @@ T allreduce(MpiCommunicator const& comm, Operation op, T const src)
     return dst;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy data from the root process to all others.
+ */
+template<class T, std::size_t N>
+void broadcast(MpiCommunicator const& comm,
+               [[maybe_unused]] int root,
+               [[maybe_unused]] Span<T, N> data)
+{
+    CELER_EXPECT(root >= 0 && root < comm.size());
+    if (!comm)
+        return;
+
+    CELER_MPI_CALL(MPI_Bcast(data.data(),
+                             data.size(),
+                             detail::MpiType<T>::get(),
+                             root,
+                             comm.mpi_comm()));
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
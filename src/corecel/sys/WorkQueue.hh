@@ -0,0 +1,218 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/WorkQueue.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Process items in order on a single long-lived background thread.
+ *
+ * Producers add items with \c push , which blocks while \c capacity items are
+ * waiting so that a slow consumer applies backpressure rather than letting
+ * memory grow without bound. The \c wait function blocks until every item
+ * pushed so far has been consumed.
+ *
+ * If the consumer throws, the exception is rethrown by the next call to
+ * \c push or \c wait , and items queued before then are discarded.
+ * Destroying the queue discards any items that have not started and joins
+ * the thread: call \c wait first to process them.
+ *
+ * \code
+   WorkQueue<Chunk> write_chunks(4, [&out](Chunk& c) { write(out, c); });
+   write_chunks.push(std::move(chunk));
+   write_chunks.wait();
+   \endcode
+ */
+template<class T>
+class WorkQueue
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using value_type = T;
+    using Consumer = std::function<void(T&)>;
+    //!@}
+
+  public:
+    // Start the thread with a maximum number of waiting items
+    inline WorkQueue(size_type capacity, Consumer consume);
+
+    // Discard waiting items and join the thread
+    inline ~WorkQueue();
+
+    //! Prevent copying and moving since the thread points to this
+    CELER_DELETE_COPY_MOVE(WorkQueue);
+
+    // Queue an item, blocking while the queue is full
+    inline void push(T item);
+
+    // Wait for all queued items to be consumed
+    inline void wait();
+
+    //! Maximum number of waiting items
+    size_type capacity() const { return capacity_; }
+
+  private:
+    size_type capacity_;
+    Consumer consume_;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::deque<T> items_;
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr exception_;
+    std::thread thread_;
+
+    // Consume items until stopped
+    inline void run();
+
+    // Rethrow a saved exception (lock must be held)
+    inline void rethrow();
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Start the thread with a maximum number of waiting items.
+ */
+template<class T>
+WorkQueue<T>::WorkQueue(size_type capacity, Consumer consume)
+    : capacity_{capacity}, consume_{std::move(consume)}
+{
+    CELER_EXPECT(capacity_ > 0);
+    CELER_EXPECT(consume_);
+
+    thread_ = std::thread([this] { this->run(); });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Discard waiting items and join the thread.
+ *
+ * An item that is already being consumed is allowed to finish.
+ */
+template<class T>
+WorkQueue<T>::~WorkQueue()
+{
+    {
+        std::lock_guard scoped_lock{mutex_};
+        stop_ = true;
+        items_.clear();
+    }
+    changed_.notify_all();
+    thread_.join();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue an item, blocking while the queue is full.
+ */
+template<class T>
+void WorkQueue<T>::push(T item)
+{
+    {
+        std::unique_lock lock{mutex_};
+        changed_.wait(lock, [this] {
+            return exception_ || items_.size() < capacity_;
+        });
+        this->rethrow();
+        items_.push_back(std::move(item));
+    }
+    changed_.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all queued items to be consumed.
+ */
+template<class T>
+void WorkQueue<T>::wait()
+{
+    std::unique_lock lock{mutex_};
+    changed_.wait(lock, [this] { return items_.empty() && !busy_; });
+    this->rethrow();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Consume items until stopped.
+ */
+template<class T>
+void WorkQueue<T>::run()
+{
+    std::unique_lock lock{mutex_};
+    while (true)
+    {
+        changed_.wait(lock, [this] { return stop_ || !items_.empty(); });
+        if (stop_)
+        {
+            return;
+        }
+        T item = std::move(items_.front());
+        items_.pop_front();
+        busy_ = true;
+        lock.unlock();
+        // Wake a producer waiting for space
+        changed_.notify_all();
+
+        std::exception_ptr error;
+        try
+        {
+            consume_(item);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (error)
+        {
+            // Only the first error is kept; discard work queued before it
+            // is seen
+            if (!exception_)
+            {
+                exception_ = std::move(error);
+            }
+            items_.clear();
+        }
+        busy_ = false;
+        changed_.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Rethrow a saved exception (lock must be held).
+ */
+template<class T>
+void WorkQueue<T>::rethrow()
+{
+    if (auto e = std::exchange(exception_, nullptr))
+    {
+        std::rethrow_exception(e);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -69,6 +69,7 @@ struct VolumeRecord
 {
     ItemRange<LocalSurfaceId> faces;
     ItemRange<logic_int> logic;
+    ItemRange<logic_int> operand_ends;  //!< Operator following each operand
 
     logic_int max_intersections{0};
     logic_int flags{0};
@@ -374,6 +375,7 @@ struct OrangeParamsData
     Items<LocalVolumeId> local_volume_ids;
     Items<RealId> real_ids;
     Items<logic_int> logic_ints;
+    Items<logic_int> operand_ends;
     Items<real_type> reals;
     Items<FastReal3> fast_real3s;
     Items<SurfaceType> surface_types;
@@ -416,6 +418,7 @@ struct OrangeParamsData
         local_volume_ids = other.local_volume_ids;
         real_ids = other.real_ids;
         logic_ints = other.logic_ints;
+        operand_ends = other.operand_ends;
         reals = other.reals;
         surface_types = other.surface_types;
         connectivity_records = other.connectivity_records;
@@ -471,6 +474,10 @@ struct OrangeStateData
     Items<LocalVolumeId> vol;
     Items<UniverseId> universe;
 
+    // Cached safety sphere with dimensions {num_tracks, max_depth}
+    Items<Real3> safety_pos;
+    Items<real_type> safety_dist;
+
     // Scratch space with dimensions {track}{max_faces}
     Items<Sense> temp_sense;
 
@@ -499,6 +506,8 @@ struct OrangeStateData
             && dir.size() == max_depth  * this->size()
             && vol.size() == max_depth  * this->size()
             && universe.size() == max_depth  * this->size()
+            && safety_pos.size() == max_depth  * this->size()
+            && safety_dist.size() == max_depth  * this->size()
             && !temp_sense.empty()
             && !temp_face.empty()
             && temp_distance.size() == temp_face.size()
@@ -531,6 +540,8 @@ struct OrangeStateData
         dir = other.dir;
         vol = other.vol;
         universe = other.universe;
+        safety_pos = other.safety_pos;
+        safety_dist = other.safety_dist;
 
         temp_sense = other.temp_sense;
 
@@ -573,6 +584,8 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     resize(&data->dir, level_states);
     resize(&data->vol, level_states);
     resize(&data->universe, level_states);
+    resize(&data->safety_pos, level_states);
+    resize(&data->safety_dist, level_states);
 
     size_type face_states = params.scalars.max_faces * num_tracks;
     resize(&data->temp_sense, face_states);
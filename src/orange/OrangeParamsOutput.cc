@@ -66,6 +66,7 @@ void OrangeParamsOutput::output(JsonPimpl* j) const
         OPO_SAVE_SIZE(local_volume_ids);
         OPO_SAVE_SIZE(real_ids);
         OPO_SAVE_SIZE(logic_ints);
+        OPO_SAVE_SIZE(operand_ends);
         OPO_SAVE_SIZE(reals);
         OPO_SAVE_SIZE(surface_types);
         OPO_SAVE_SIZE(connectivity_records);
@@ -10,6 +10,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Array.hh"
+#include "corecel/math/ArrayUtils.hh"
 #include "corecel/sys/ThreadId.hh"
 
 #include "OrangeData.hh"
@@ -317,6 +318,7 @@ OrangeTrackView::operator=(Initializer_t const& init)
         lsa.pos() = local.pos;
         lsa.dir() = local.dir;
         lsa.universe() = uid;
+        lsa.safety_dist() = 0;
 
         daughter_id = visit_tracker(
             [&tinit](auto&& t) { return t.daughter(tinit.volume); }, uid);
@@ -669,7 +671,11 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
         failed_ = true;
         volume = orange_exterior_volume;
     }
-    make_lsa(level).vol() = volume;
+    {
+        auto lsa = make_lsa(level);
+        lsa.vol() = volume;
+        lsa.safety_dist() = 0;
+    }
 
     // Clear local surface before diving into daughters
     // TODO: this is where we'd do inter-universe mapping
@@ -722,6 +728,7 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
         lsa.pos() = local.pos;
         lsa.dir() = local.dir;
         lsa.universe() = universe;
+        lsa.safety_dist() = 0;
     }
 
     // Save final level
@@ -964,42 +971,69 @@ OrangeTrackView::find_next_step_impl(detail::Intersection isect)
 //---------------------------------------------------------------------------//
 /*!
  * Find the distance to the nearest boundary in any direction.
+ */
+CELER_FUNCTION real_type OrangeTrackView::find_safety()
+{
+    return this->find_safety(numeric_limits<real_type>::infinity());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the distance to the nearest nearby boundary.
  *
  * The safety distance at a given point is the minimum safety distance over all
  * levels, since surface deduplication can potentionally elide bounding
- * surfaces at more deeply embedded levels.
+ * surfaces at more deeply embedded levels. Levels are searched from the
+ * innermost outward, since the innermost volume usually has the closest
+ * surfaces, and the search stops as soon as the safety is zero.
+ *
+ * The safety sphere calculated at each level is cached in the state. Because
+ * the safety distance decreases by at most the distance moved, the cached
+ * radius minus the distance from its center is a lower bound on the safety
+ * at that level. A level's safety is only recalculated if that bound is
+ * smaller than the current result, so outer levels (whose volumes are
+ * typically large) are rarely recalculated while the track moves in small
+ * steps. The cache for a level is invalidated whenever the volume at that
+ * level changes.
+ *
+ * The result is limited to the maximum step: the caller only needs to know
+ * whether the boundary is farther away than that.
  */
-CELER_FUNCTION real_type OrangeTrackView::find_safety()
+CELER_FUNCTION real_type OrangeTrackView::find_safety(real_type max_step)
 {
     CELER_EXPECT(!this->is_on_boundary());
+    CELER_EXPECT(max_step > 0);
 
     TrackerVisitor visit_tracker{params_};
 
-    real_type min_safety_dist = numeric_limits<real_type>::infinity();
+    real_type min_safety_dist = max_step;
 
-    for (auto lev : range(LevelId{this->level() + 1}))
+    for (auto lev = LevelId{this->level() + 1};
+         lev != LevelId{0} && min_safety_dist > 0;)
     {
+        --lev;
         auto lsa = this->make_lsa(lev);
-        auto sd = visit_tracker(
-            [&lsa](auto&& t) { return t.safety(lsa.pos(), lsa.vol()); },
-            lsa.universe());
+
+        // Bound the safety using the cached sphere
+        real_type sd = lsa.safety_dist();
+        if (sd > 0)
+        {
+            sd -= distance(lsa.pos(), lsa.safety_pos());
+        }
+        if (sd < min_safety_dist)
+        {
+            // Cached sphere might limit the safety: recalculate
+            sd = visit_tracker(
+                [&lsa](auto&& t) { return t.safety(lsa.pos(), lsa.vol()); },
+                lsa.universe());
+            lsa.safety_pos() = lsa.pos();
+            lsa.safety_dist() = sd;
+        }
         min_safety_dist = celeritas::min(min_safety_dist, sd);
     }
     return min_safety_dist;
 }
 
-//---------------------------------------------------------------------------//
-/*!
- * Find the distance to the nearest nearby boundary.
- *
- * Since we currently support only "simple" safety distances, we can't
- * eliminate anything by checking only nearby surfaces.
- */
-CELER_FUNCTION real_type OrangeTrackView::find_safety(real_type)
-{
-    return this->find_safety();
-}
-
 //---------------------------------------------------------------------------//
 /*!
  * Get a reference to the current volume, or to world volume if outside.
@@ -60,6 +60,16 @@ class LevelStateAccessor
         return states_->universe[OpaqueId<UniverseId>{index_}];
     }
 
+    CELER_FUNCTION Real3& safety_pos()
+    {
+        return states_->safety_pos[OpaqueId<Real3>{index_}];
+    }
+
+    CELER_FUNCTION real_type& safety_dist()
+    {
+        return states_->safety_dist[OpaqueId<real_type>{index_}];
+    }
+
     //// CONST ACCESSORS ////
 
     CELER_FUNCTION LocalVolumeId const& vol() const
@@ -82,6 +92,16 @@ class LevelStateAccessor
         return states_->universe[OpaqueId<UniverseId>{index_}];
     }
 
+    CELER_FUNCTION Real3 const& safety_pos() const
+    {
+        return states_->safety_pos[OpaqueId<Real3>{index_}];
+    }
+
+    CELER_FUNCTION real_type const& safety_dist() const
+    {
+        return states_->safety_dist[OpaqueId<real_type>{index_}];
+    }
+
   private:
     StateRef const* const states_;
     size_type const index_;
@@ -113,6 +133,8 @@ LevelStateAccessor::operator=(LevelStateAccessor const& other)
     this->pos() = other.pos();
     this->dir() = other.dir();
     this->universe() = other.universe();
+    this->safety_pos() = other.safety_pos();
+    this->safety_dist() = other.safety_dist();
 
     return *this;
 }
@@ -0,0 +1,302 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/LogicUtils.cc
+//---------------------------------------------------------------------------//
+#include "LogicUtils.hh"
+
+#include <algorithm>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+#include "../univ/detail/LogicStack.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Node in an expression tree with n-ary "and" and "or"
+struct LogicNode
+{
+    logic_int token{};
+    std::vector<size_type> children;
+    size_type cost{0};
+    size_type depth{1};  //!< Minimum stack depth to evaluate
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build a tree from a postfix expression and write it back out sorted.
+ */
+class LogicSorter
+{
+  public:
+    explicit LogicSorter(Span<size_type const> cost) : cost_{cost} {}
+
+    // Build the tree, returning false if the logic is malformed
+    bool build(Span<logic_int const> logic);
+
+    // Write the sorted tree in postfix, not exceeding the given depth
+    bool emit(size_type max_depth, std::vector<logic_int>* result);
+
+    //! Stack depth of the original expression
+    size_type depth() const { return depth_; }
+
+  private:
+    Span<size_type const> cost_;
+    std::vector<LogicNode> nodes_;
+    std::vector<size_type> stack_;
+    size_type depth_{1};
+
+    void emit(size_type n, size_type max_depth, std::vector<logic_int>* result);
+    size_type chain_depth(std::vector<size_type> const& children) const;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the tree, returning false if the logic is malformed.
+ *
+ * Nested "and" and "or" operations are flattened into a single node.
+ */
+bool LogicSorter::build(Span<logic_int const> logic)
+{
+    for (logic_int lgc : logic)
+    {
+        LogicNode node;
+        node.token = lgc;
+        if (!logic::is_operator_token(lgc))
+        {
+            CELER_EXPECT(lgc < cost_.size());
+            node.cost = cost_[lgc];
+        }
+        else if (lgc == logic::lnot)
+        {
+            if (stack_.empty())
+            {
+                return false;
+            }
+            node.children.push_back(stack_.back());
+            node.cost = nodes_[stack_.back()].cost;
+            node.depth = nodes_[stack_.back()].depth;
+            stack_.pop_back();
+        }
+        else if (lgc == logic::land || lgc == logic::lor)
+        {
+            if (stack_.size() < 2)
+            {
+                return false;
+            }
+            depth_ = std::max<size_type>(depth_, stack_.size());
+            for (size_type operand : {stack_[stack_.size() - 2], stack_.back()})
+            {
+                LogicNode& child = nodes_[operand];
+                if (child.token == lgc)
+                {
+                    // Flatten a nested operation of the same type
+                    node.children.insert(node.children.end(),
+                                         child.children.begin(),
+                                         child.children.end());
+                }
+                else
+                {
+                    node.children.push_back(operand);
+                }
+                node.cost += child.cost;
+            }
+            stack_.resize(stack_.size() - 2);
+
+            // Evaluate the deepest operand first to minimize the stack
+            auto children = node.children;
+            std::sort(children.begin(),
+                      children.end(),
+                      [this](size_type a, size_type b) {
+                          return nodes_[a].depth > nodes_[b].depth;
+                      });
+            node.depth = this->chain_depth(children);
+        }
+        else if (lgc != logic::ltrue)
+        {
+            return false;
+        }
+        stack_.push_back(nodes_.size());
+        nodes_.push_back(std::move(node));
+    }
+    return stack_.size() == 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the sorted tree in postfix, not exceeding the given depth.
+ *
+ * Return false without writing if the expression cannot fit.
+ */
+bool LogicSorter::emit(size_type max_depth, std::vector<logic_int>* result)
+{
+    CELER_EXPECT(stack_.size() == 1);
+    if (nodes_[stack_.front()].depth > max_depth)
+    {
+        return false;
+    }
+    this->emit(stack_.front(), max_depth, result);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a node, sorting the operands of "and" and "or" by increasing cost.
+ *
+ * The operands are written as a left-deep chain: the first can use the full
+ * depth, but each later one is evaluated on top of the partial result.
+ * If the cheapest ordering would exceed the maximum depth, the deepest
+ * operand is moved to the front.
+ */
+void LogicSorter::emit(size_type n,
+                       size_type max_depth,
+                       std::vector<logic_int>* result)
+{
+    LogicNode& node = nodes_[n];
+    CELER_EXPECT(node.depth <= max_depth);
+    if (node.token == logic::land || node.token == logic::lor)
+    {
+        auto& children = node.children;
+        std::stable_sort(children.begin(),
+                         children.end(),
+                         [this](size_type a, size_type b) {
+                             return nodes_[a].cost < nodes_[b].cost;
+                         });
+        if (this->chain_depth(children) > max_depth)
+        {
+            auto deepest = std::max_element(
+                children.begin(),
+                children.end(),
+                [this](size_type a, size_type b) {
+                    return nodes_[a].depth < nodes_[b].depth;
+                });
+            std::rotate(children.begin(), deepest, deepest + 1);
+        }
+        CELER_ASSERT(this->chain_depth(children) <= max_depth);
+
+        auto iter = children.begin();
+        this->emit(*iter++, max_depth, result);
+        for (; iter != children.end(); ++iter)
+        {
+            this->emit(*iter, max_depth - 1, result);
+            result->push_back(node.token);
+        }
+        return;
+    }
+
+    for (size_type child : node.children)
+    {
+        this->emit(child, max_depth, result);
+    }
+    result->push_back(node.token);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the stack depth of a chain of operands in the given order.
+ */
+size_type
+LogicSorter::chain_depth(std::vector<size_type> const& children) const
+{
+    CELER_EXPECT(children.size() >= 2);
+    size_type result = nodes_[children.front()].depth;
+    for (auto iter = children.begin() + 1; iter != children.end(); ++iter)
+    {
+        result = std::max(result, nodes_[*iter].depth + 1);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reorder the operands of a postfix expression by increasing cost.
+ *
+ * The cost of evaluating each face is given by the \c cost array, and the
+ * cost of a subexpression is the total cost of its faces. Since "and" and "or"
+ * are commutative, their operands can be evaluated in any order; with a
+ * short-circuiting evaluator, putting the cheapest operands first avoids
+ * evaluating the expensive ones whenever possible. Chains of the same
+ * operator are flattened and rewritten left-to-right, and operands of equal
+ * cost keep their original order.
+ *
+ * The result never needs a deeper logic stack than the original expression,
+ * nor one deeper than the device logic stack allows.
+ *
+ * A malformed expression (or one that is too deep) is returned unchanged so
+ * that the caller can diagnose it.
+ */
+std::vector<logic_int>
+sort_logic_operands(Span<logic_int const> logic, Span<size_type const> cost)
+{
+    std::vector<logic_int> result;
+    LogicSorter sort_logic{cost};
+    result.reserve(logic.size());
+    if (!sort_logic.build(logic)
+        || !sort_logic.emit(
+            std::min(sort_logic.depth(), LogicStack::max_stack_depth() - 1),
+            &result))
+    {
+        result.assign(logic.begin(), logic.end());
+        return result;
+    }
+
+    CELER_ENSURE(result.size() == logic.size());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the operator that combines each operand with the value below it.
+ *
+ * If the subexpression starting at token \c i is the second operand of the
+ * binary operator at token \c j , the result at \c i is \c j . For every
+ * other token (operators and first operands) the result is the size of the
+ * logic. A short-circuiting evaluator uses this to skip an operand without
+ * scanning its tokens.
+ *
+ * The expression must be well formed.
+ */
+std::vector<logic_int> calc_operand_ends(Span<logic_int const> logic)
+{
+    std::vector<logic_int> result(logic.size(),
+                                  static_cast<logic_int>(logic.size()));
+
+    // First token of each subexpression on the stack
+    std::vector<logic_int> starts;
+    for (auto i : range<logic_int>(logic.size()))
+    {
+        logic_int const lgc = logic[i];
+        if (lgc == logic::land || lgc == logic::lor)
+        {
+            CELER_EXPECT(starts.size() >= 2);
+            result[starts.back()] = i;
+            starts.pop_back();
+        }
+        else if (lgc == logic::lnot)
+        {
+            // Negation doesn't change where its operand starts
+            CELER_EXPECT(!starts.empty());
+        }
+        else
+        {
+            starts.push_back(i);
+        }
+    }
+    CELER_ENSURE(starts.size() == 1);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,30 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/LogicUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/cont/Span.hh"
+
+#include "../OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Reorder the operands of a postfix expression by increasing cost
+std::vector<logic_int>
+sort_logic_operands(Span<logic_int const> logic, Span<size_type const> cost);
+
+// Find the operator that combines each operand with the value below it
+std::vector<logic_int> calc_operand_ends(Span<logic_int const> logic);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -21,6 +21,7 @@
 #include "corecel/data/Ref.hh"
 #include "corecel/math/Algorithms.hh"
 
+#include "LogicUtils.hh"
 #include "UniverseInserter.hh"
 #include "../OrangeInput.hh"
 #include "../surf/LocalSurfaceVisitor.hh"
@@ -118,6 +119,52 @@ struct NumIntersectionGetter
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return the relative cost of calculating the sense of a surface.
+ *
+ * This is roughly the number of floating point operations, so that planes are
+ * evaluated before quadrics. All planes share the lowest cost: reordering
+ * them gains little, and keeping their input order lets array elements whose
+ * sides are a mix of axis-aligned and general planes share the same
+ * deduplicated logic.
+ */
+struct SenseCostGetter
+{
+    template<class S>
+    constexpr size_type operator()(S const&) const noexcept
+    {
+        switch (S::surface_type())
+        {
+            case SurfaceType::px:
+            case SurfaceType::py:
+            case SurfaceType::pz:
+            case SurfaceType::p:
+                return 1;
+            case SurfaceType::cxc:
+            case SurfaceType::cyc:
+            case SurfaceType::czc:
+            case SurfaceType::sc:
+                return 3;
+            case SurfaceType::cx:
+            case SurfaceType::cy:
+            case SurfaceType::cz:
+            case SurfaceType::s:
+                return 5;
+            case SurfaceType::kx:
+            case SurfaceType::ky:
+            case SurfaceType::kz:
+                return 6;
+            case SurfaceType::sq:
+                return 9;
+            case SurfaceType::gq:
+                return 15;
+            default:
+                return 30;
+        }
+    }
+};
+
 //---------------------------------------------------------------------------//
 //! Construct surface labels, empty if needed
 std::vector<Label> make_surface_labels(UnitInput& inp)
@@ -194,6 +241,7 @@ UnitInserter::UnitInserter(UniverseInserter* insert_universe, Data* orange_data)
     , local_volume_ids_{&orange_data_->local_volume_ids}
     , real_ids_{&orange_data_->real_ids}
     , logic_ints_{&orange_data_->logic_ints}
+    , operand_ends_{&orange_data_->operand_ends}
     , reals_{&orange_data_->reals}
     , surface_types_{&orange_data_->surface_types}
     , connectivity_records_{&orange_data_->connectivity_records}
@@ -332,15 +380,22 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
     // Mark as 'simple safety' if all the surfaces are simple
     bool simple_safety = true;
     size_type max_intersections = 0;
+    std::vector<size_type> face_cost;
+    face_cost.reserve(v.faces.size());
 
     for (LocalSurfaceId sid : v.faces)
     {
         simple_safety = simple_safety
                         && visit_surface(SimpleSafetyGetter{}, sid);
         max_intersections += visit_surface(NumIntersectionGetter{}, sid);
+        face_cost.push_back(visit_surface(SenseCostGetter{}, sid));
     }
 
-    auto input_logic = make_span(v.logic);
+    // Evaluate cheap surfaces first when short-circuiting the logic. The
+    // faces themselves must stay sorted by surface ID.
+    auto const sorted_logic
+        = sort_logic_operands(make_span(v.logic), make_span(face_cost));
+    auto input_logic = make_span(sorted_logic);
     if (v.zorder == ZOrder::background)
     {
         // "Background" volumes should not be explicitly reachable by logic or
@@ -374,6 +429,11 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
     CELER_VALIDATE(max_depth > 0,
                    << "invalid logic definition: operators do not balance");
 
+    // Save where each operand ends so that it can be skipped cheaply
+    auto const operand_ends = calc_operand_ends(input_logic);
+    output.operand_ends
+        = operand_ends_.insert_back(operand_ends.begin(), operand_ends.end());
+
     // Update global max faces/intersections/logic
     OrangeParamsScalars& scalars = orange_data_->scalars;
     inplace_max<size_type>(&scalars.max_faces, output.faces.size());
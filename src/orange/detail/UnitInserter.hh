@@ -58,6 +58,7 @@ class UnitInserter
     DedupeCollectionBuilder<LocalVolumeId> local_volume_ids_;
     DedupeCollectionBuilder<OpaqueId<real_type>> real_ids_;
     DedupeCollectionBuilder<logic_int> logic_ints_;
+    DedupeCollectionBuilder<logic_int> operand_ends_;
     DedupeCollectionBuilder<real_type> reals_;
     DedupeCollectionBuilder<SurfaceType> surface_types_;
     CollectionBuilder<ConnectivityRecord> connectivity_records_;
@@ -16,6 +16,7 @@
 #include "detail/InfixEvaluator.hh"
 #include "detail/LogicEvaluator.hh"
 #include "detail/SenseCalculator.hh"
+#include "detail/SenseLogicEvaluator.hh"
 #include "detail/SurfaceFunctors.hh"
 #include "detail/Types.hh"
 #include "detail/Utils.hh"
@@ -165,18 +166,17 @@ SimpleUnitTracker::initialize(LocalState const& state) const -> Initialization
     CELER_EXPECT(params_);
     CELER_EXPECT(!state.surface && !state.volume);
 
-    detail::SenseCalculator calc_senses(
-        this->make_surface_visitor(), state.pos, state.temp_sense);
+    detail::SenseLogicEvaluator calc_inside(this->make_surface_visitor(),
+                                            state.pos);
 
     // Use the BIH to locate a position that's inside, and save whether it's on
     // a surface in the found volume
     bool on_surface{false};
     auto is_inside
-        = [this, &calc_senses, &on_surface](LocalVolumeId id) -> bool {
-        VolumeView vol = this->make_local_volume(id);
-        auto logic_state = calc_senses(vol);
+        = [this, &calc_inside, &on_surface](LocalVolumeId id) -> bool {
+        auto logic_state = calc_inside(this->make_local_volume(id));
         on_surface = static_cast<bool>(logic_state.face);
-        return detail::LogicEvaluator(vol.logic())(logic_state.senses);
+        return logic_state.inside;
     };
     LocalVolumeId id = this->find_volume_where(state.pos, is_inside);
 
@@ -202,11 +202,11 @@ CELER_FUNCTION auto
 SimpleUnitTracker::cross_boundary(LocalState const& state) const -> Initialization
 {
     CELER_EXPECT(state.surface && state.volume);
-    detail::SenseCalculator calc_senses(
-        this->make_surface_visitor(), state.pos, state.temp_sense);
+    detail::SenseLogicEvaluator calc_inside(this->make_surface_visitor(),
+                                            state.pos);
 
     detail::OnLocalSurface on_surface;
-    auto is_inside = [this, &state, &calc_senses, &on_surface](
+    auto is_inside = [this, &state, &calc_inside, &on_surface](
                          LocalVolumeId const& id) -> bool {
         if (id == state.volume)
         {
@@ -216,9 +216,9 @@ SimpleUnitTracker::cross_boundary(LocalState const& state) const -> Initializati
 
         VolumeView vol = this->make_local_volume(id);
         auto logic_state
-            = calc_senses(vol, detail::find_face(vol, state.surface));
+            = calc_inside(vol, detail::find_face(vol, state.surface));
 
-        if (detail::LogicEvaluator(vol.logic())(logic_state.senses))
+        if (logic_state.inside)
         {
             // Inside: find and save the local surface ID, and end the search
             on_surface = get_surface(vol, logic_state.face);
@@ -285,12 +285,13 @@ SimpleUnitTracker::intersect(LocalState const& state,
 /*!
  * Calculate nearest distance to a surface in any direction.
  *
- * The safety calculation uses a very limited method for calculating the safety
- * distance: it's the nearest distance to any surface, for a certain subset of
- * surfaces.  Other surface types will return a safety distance of zero.
- * Complex surfaces might return the distance to internal surfaces that do not
- * represent the edge of a volume. Such distances are conservative but will
- * necessarily slow down the simulation.
+ * The safety distance is the nearest distance to any face of the volume.
+ * Simple surfaces (planes, spheres, centered cylinders) return the exact
+ * distance; other quadrics and involutes return a conservative lower bound
+ * (see \c detail::SafetyBoundCalculator ). Complex volumes might return the
+ * distance to internal surfaces that do not represent the edge of a volume.
+ * Such distances are conservative but will necessarily slow down the
+ * simulation.
  */
 CELER_FUNCTION real_type SimpleUnitTracker::safety(Real3 const& pos,
                                                    LocalVolumeId volid) const
@@ -298,12 +299,6 @@ CELER_FUNCTION real_type SimpleUnitTracker::safety(Real3 const& pos,
     CELER_EXPECT(volid);
 
     VolumeView vol = this->make_local_volume(volid);
-    if (!vol.simple_safety())
-    {
-        // Has a tricky surface: we can't use the simple algorithm to calculate
-        // the safety, so return a conservative estimate.
-        return 0;
-    }
 
     // Calculate minimim distance to all local faces
     real_type result = numeric_limits<real_type>::infinity();
@@ -312,6 +307,11 @@ CELER_FUNCTION real_type SimpleUnitTracker::safety(Real3 const& pos,
     for (LocalSurfaceId surface : vol.faces())
     {
         result = celeritas::min(result, visit_surface(calc_safety, surface));
+        if (result == 0)
+        {
+            // Can't get any closer
+            break;
+        }
     }
 
     CELER_ENSURE(result >= 0);
@@ -580,7 +580,9 @@ SimpleUnitTracker::complex_intersect(LocalState const& state,
  *
  * It's not cheap, as there are many embedded loops:
  * - Intersection points
- * - Volumes connected to the surface being intersected
+ * - Volumes whose bounding boxes contain the bumped intersection point (found
+ *   with the BIH), filtered to those connected to the surface being
+ *   intersected
  * - Surfaces connected to the target volume (sense evaluation) plus number of
  *   elements in the logic array ("is_inside" evaluation)
  *
@@ -614,29 +616,41 @@ CELER_FUNCTION auto SimpleUnitTracker::background_intersect(
         Real3 pos{state.pos};
         axpy(state.temp_next.distance[isect] + bump_dist, state.dir, &pos);
 
-        // Loop over volumes connected to this surface.
-        //! \todo Accelerate by intersecting neighbors with BVH grid
-        for (LocalVolumeId vid : this->get_neighbors(surface))
-        {
-            CELER_ASSERT(vid != state.volume);
+        // Find the volume connected to this surface that contains the bumped
+        // point. The BIH skips volumes whose bounding boxes exclude the
+        // point, so only a few candidates need their logic evaluated.
+        Intersection result;
+        auto is_entered = [&](LocalVolumeId vid) -> bool {
+            if (vid == state.volume)
+            {
+                return false;
+            }
             VolumeView vol = this->make_local_volume(vid);
-            auto logic_state = detail::SenseCalculator{
-                this->make_surface_visitor(), pos, state.temp_sense}(vol);
-
-            if (detail::LogicEvaluator{vol.logic()}(logic_state.senses))
+            auto face = vol.find_face(surface);
+            if (!face)
+            {
+                // Volume isn't connected to the crossed surface
+                return false;
+            }
+            auto visit_surface = this->make_surface_visitor();
+            if (!detail::SenseLogicEvaluator{visit_surface, pos}(vol).inside)
             {
-                // We are in this new volume by crossing the tested surface.
-                // Get the sense corresponding to this "crossed" surface.
-                auto face = vol.find_face(surface);
-                CELER_ASSERT(face);
-
-                Intersection result;
-                result.distance = state.temp_next.distance[isect];
-                result.surface = detail::OnLocalSurface{
-                    surface,
-                    flip_sense(logic_state.senses[face.unchecked_get()])};
-                return result;
+                return false;
             }
+
+            // We are in this new volume by crossing the tested surface.
+            // Get the sense corresponding to this "crossed" surface, which
+            // may not have been evaluated due to short-circuiting.
+            Sense entered_sense
+                = to_sense(visit_surface(detail::CalcSense{pos}, surface));
+            result.distance = state.temp_next.distance[isect];
+            result.surface
+                = detail::OnLocalSurface{surface, flip_sense(entered_sense)};
+            return true;
+        };
+        if (this->find_volume_where(pos, is_entered))
+        {
+            return result;
         }
     }
 
@@ -62,6 +62,9 @@ class VolumeView
     // Get logic definition
     CELER_FORCEINLINE_FUNCTION LdgSpan<logic_int const> logic() const;
 
+    // Get the operator following each operand in the logic
+    CELER_FORCEINLINE_FUNCTION LdgSpan<logic_int const> operand_ends() const;
+
     // Get the number of total intersections
     CELER_FORCEINLINE_FUNCTION logic_int max_intersections() const;
 
@@ -168,6 +171,17 @@ CELER_FUNCTION LdgSpan<logic_int const> VolumeView::logic() const
     return params_.logic_ints[def_.logic];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the operator following each operand in the logic.
+ *
+ * \sa calc_operand_ends
+ */
+CELER_FUNCTION LdgSpan<logic_int const> VolumeView::operand_ends() const
+{
+    return params_.operand_ends[def_.operand_ends];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the maximum number of surface intersections.
@@ -0,0 +1,235 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/SafetyBoundCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/surf/ConeAligned.hh"
+#include "orange/surf/CylAligned.hh"
+#include "orange/surf/GeneralQuadric.hh"
+#include "orange/surf/Involute.hh"
+#include "orange/surf/SimpleQuadric.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a lower bound on the distance from a point to a surface.
+ *
+ * This is used for surfaces whose nearest distance is \em not the
+ * intersection along the surface normal (i.e., without "simple safety").
+ *
+ * For a quadric \f$ f(x) = x^T A x + b \cdot x + c \f$, expanding about the
+ * point gives \f[
+   f(x + d) = f(x) + \nabla f(x) \cdot d + d^T A d
+ * \f]
+ * so a point on the surface at distance \em r from \em x requires \f$ |f(x)|
+ * \le |\nabla f(x)| r + \|A\| r^2 \f$. The smallest nonnegative \em r
+ * satisfying this is a conservative safety distance. The matrix norm is
+ * bounded above by its Frobenius norm.
+ *
+ * Involutes are bounded by the distance to the annulus that contains the
+ * sense-changing region.
+ */
+class SafetyBoundCalculator
+{
+  public:
+    // Construct with the point
+    explicit CELER_FUNCTION SafetyBoundCalculator(Real3 const& pos)
+        : pos_(pos)
+    {
+    }
+
+    // Calculate for a simple quadric
+    inline CELER_FUNCTION real_type operator()(SimpleQuadric const&) const;
+
+    // Calculate for a general quadric
+    inline CELER_FUNCTION real_type operator()(GeneralQuadric const&) const;
+
+    // Calculate for an axis-aligned cone
+    template<Axis T>
+    inline CELER_FUNCTION real_type operator()(ConeAligned<T> const&) const;
+
+    // Calculate for an axis-aligned cylinder
+    template<Axis T>
+    inline CELER_FUNCTION real_type operator()(CylAligned<T> const&) const;
+
+    // Calculate for an involute
+    inline CELER_FUNCTION real_type operator()(Involute const&) const;
+
+    //! Conservatively return zero for any other surface
+    template<class S>
+    CELER_FUNCTION real_type operator()(S const&) const
+    {
+        return 0;
+    }
+
+  private:
+    Real3 const& pos_;
+
+    // Calculate the quadric bound from the value, gradient, and matrix norm
+    static inline CELER_FUNCTION real_type calc_quadric(real_type value,
+                                                        real_type grad_norm,
+                                                        real_type mat_norm);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate for a simple quadric.
+ */
+CELER_FUNCTION real_type
+SafetyBoundCalculator::operator()(SimpleQuadric const& sq) const
+{
+    auto abc = sq.second();
+    auto def = sq.first();
+
+    real_type value = sq.zeroth();
+    Real3 grad;
+    real_type mat_norm = 0;
+    for (auto i : range(3))
+    {
+        value += (abc[i] * pos_[i] + def[i]) * pos_[i];
+        grad[i] = 2 * abc[i] * pos_[i] + def[i];
+        // Diagonal matrix: norm is the largest magnitude
+        mat_norm = celeritas::max(mat_norm, std::fabs(abc[i]));
+    }
+    return calc_quadric(value, norm(grad), mat_norm);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate for a general quadric.
+ */
+CELER_FUNCTION real_type
+SafetyBoundCalculator::operator()(GeneralQuadric const& gq) const
+{
+    auto abc = gq.second();
+    auto def = gq.cross();
+    auto ghi = gq.first();
+    real_type const x = pos_[0];
+    real_type const y = pos_[1];
+    real_type const z = pos_[2];
+
+    real_type value = (abc[0] * x + def[0] * y + def[2] * z + ghi[0]) * x
+                      + (abc[1] * y + def[1] * z + ghi[1]) * y
+                      + (abc[2] * z + ghi[2]) * z + gq.zeroth();
+    Real3 grad{2 * abc[0] * x + def[0] * y + def[2] * z + ghi[0],
+               2 * abc[1] * y + def[0] * x + def[1] * z + ghi[1],
+               2 * abc[2] * z + def[1] * y + def[2] * x + ghi[2]};
+    // Off-diagonal matrix entries are half the cross terms
+    real_type mat_norm_sq = 0;
+    for (auto i : range(3))
+    {
+        mat_norm_sq += ipow<2>(abc[i]) + ipow<2>(def[i]) / 2;
+    }
+    real_type mat_norm = std::sqrt(mat_norm_sq);
+    return calc_quadric(value, norm(grad), mat_norm);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate for an axis-aligned cone.
+ */
+template<Axis T>
+CELER_FUNCTION real_type
+SafetyBoundCalculator::operator()(ConeAligned<T> const& cone) const
+{
+    using Cone = ConeAligned<T>;
+    auto const& origin = cone.origin();
+    real_type const t = pos_[to_int(T)] - origin[to_int(T)];
+    real_type const u = pos_[to_int(Cone::u_axis())]
+                        - origin[to_int(Cone::u_axis())];
+    real_type const v = pos_[to_int(Cone::v_axis())]
+                        - origin[to_int(Cone::v_axis())];
+    real_type const tsq = cone.tangent_sq();
+
+    real_type value = ipow<2>(u) + ipow<2>(v) - tsq * ipow<2>(t);
+    real_type grad_norm = 2
+                          * std::sqrt(ipow<2>(u) + ipow<2>(v)
+                                      + ipow<2>(tsq * t));
+    return calc_quadric(value, grad_norm, celeritas::max(real_type{1}, tsq));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate for an axis-aligned cylinder.
+ *
+ * The distance to a cylinder is exact.
+ */
+template<Axis T>
+CELER_FUNCTION real_type
+SafetyBoundCalculator::operator()(CylAligned<T> const& cyl) const
+{
+    using Cyl = CylAligned<T>;
+    real_type const u = pos_[to_int(Cyl::u_axis())] - cyl.origin_u();
+    real_type const v = pos_[to_int(Cyl::v_axis())] - cyl.origin_v();
+    return std::fabs(std::sqrt(ipow<2>(u) + ipow<2>(v))
+                     - std::sqrt(cyl.radius_sq()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate for an involute.
+ *
+ * The involute's "inside" region is bounded radially by the curve's radii at
+ * its minimum and maximum parameter values.
+ */
+CELER_FUNCTION real_type
+SafetyBoundCalculator::operator()(Involute const& inv) const
+{
+    auto const& origin = inv.origin();
+    real_type const rho = std::sqrt(ipow<2>(pos_[0] - origin[0])
+                                    + ipow<2>(pos_[1] - origin[1]));
+    real_type const r_b = inv.r_b();
+    real_type const r_min = r_b * std::sqrt(1 + ipow<2>(inv.tmin()));
+    real_type const r_max = r_b * std::sqrt(1 + ipow<2>(inv.tmax()));
+
+    if (rho < r_min)
+    {
+        return r_min - rho;
+    }
+    if (rho > r_max)
+    {
+        return rho - r_max;
+    }
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the quadric bound from the value, gradient, and matrix norm.
+ *
+ * This is the positive root of \f$ \|A\| r^2 + |\nabla f| r - |f| = 0 \f$,
+ * written to avoid cancellation and to handle a vanishing matrix norm.
+ */
+CELER_FUNCTION real_type SafetyBoundCalculator::calc_quadric(
+    real_type value, real_type grad_norm, real_type mat_norm)
+{
+    CELER_EXPECT(grad_norm >= 0 && mat_norm >= 0);
+    value = std::fabs(value);
+    real_type denom
+        = grad_norm + std::sqrt(ipow<2>(grad_norm) + 4 * mat_norm * value);
+    if (denom == 0)
+    {
+        // Degenerate point (e.g., cone vanishing point)
+        return 0;
+    }
+    return 2 * value / denom;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,197 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/SenseLogicEvaluator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/LdgIterator.hh"
+#include "orange/OrangeTypes.hh"
+#include "orange/surf/LocalSurfaceVisitor.hh"
+
+#include "LogicStack.hh"
+#include "SurfaceFunctors.hh"
+#include "Types.hh"
+#include "../VolumeView.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Determine whether a point is inside a volume, calculating senses lazily.
+ *
+ * This combines \c SenseCalculator and \c LogicEvaluator: rather than
+ * calculating the sense of every face up front, the postfix logic is walked
+ * and each surface sense is calculated only when it is pushed onto the stack.
+ * Whenever the value on top of the stack is about to be combined with the
+ * following operand by an operator that it already determines (\c false with
+ * \c logic::land, \c true with \c logic::lor), the operand is skipped
+ * without evaluating its surfaces.
+ *
+ * Since skipped surfaces are never evaluated, the resulting \c face is the
+ * first face that the point is "on" *among the evaluated surfaces*. A skipped
+ * surface cannot change whether the point is inside the volume.
+ */
+class SenseLogicEvaluator
+{
+  public:
+    //@{
+    //! \name Type aliases
+    using SpanConstLogic = LdgSpan<logic_int const>;
+    //@}
+
+    //! Return result
+    struct result_type
+    {
+        bool inside{false};  //!< Whether the point is inside the volume
+        OnFace face;  //!< The first evaluated face that we are "on"
+    };
+
+  public:
+    // Construct from persistent and current data
+    inline CELER_FUNCTION
+    SenseLogicEvaluator(LocalSurfaceVisitor const& visit, Real3 const& pos);
+
+    // Evaluate whether the point is in the given volume, possibly on a face
+    inline CELER_FUNCTION result_type operator()(VolumeView const& vol,
+                                                 OnFace face = {});
+
+  private:
+    //! Apply a function to a local surface
+    LocalSurfaceVisitor visit_;
+
+    //! Local position
+    Real3 pos_;
+
+    // Skip operands whose value can't change the top of the stack
+    static inline CELER_FUNCTION size_type short_circuit(
+        SpanConstLogic logic, SpanConstLogic ends, size_type i, bool top);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from persistent and current data.
+ */
+CELER_FUNCTION
+SenseLogicEvaluator::SenseLogicEvaluator(LocalSurfaceVisitor const& visit,
+                                         Real3 const& pos)
+    : visit_{visit}, pos_(pos)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate whether the point is in the given volume.
+ *
+ * If the face is given, its sense is known a priori and its surface is not
+ * evaluated. Otherwise, if the point is exactly on one of the evaluated
+ * surfaces, the \c face value of the result will be set.
+ */
+CELER_FUNCTION auto
+SenseLogicEvaluator::operator()(VolumeView const& vol, OnFace face)
+    -> result_type
+{
+    CELER_EXPECT(!face || face.id() < vol.num_faces());
+
+    SpanConstLogic const logic = vol.logic();
+    SpanConstLogic const ends = vol.operand_ends();
+    CELER_EXPECT(!logic.empty());
+    CELER_EXPECT(ends.size() == logic.size());
+
+    result_type result;
+    result.face = face;
+
+    LogicStack stack;
+    size_type i = 0;
+    while (i < logic.size())
+    {
+        logic_int const lgc = logic[i++];
+        if (!logic::is_operator_token(lgc))
+        {
+            // Calculate the sense of this face
+            CELER_EXPECT(lgc < vol.num_faces());
+            FaceId const cur_face{lgc};
+            Sense cur_sense;
+            if (cur_face != face.id())
+            {
+                SignedSense ss
+                    = visit_(CalcSense{pos_}, vol.get_surface(cur_face));
+                cur_sense = to_sense(ss);
+                if (!result.face && ss == SignedSense::on)
+                {
+                    // This is the first face that we're exactly on: save it
+                    result.face = {cur_face, cur_sense};
+                }
+            }
+            else
+            {
+                // Sense is known a priori
+                cur_sense = face.sense();
+            }
+            stack.push(static_cast<bool>(cur_sense));
+        }
+        else
+        {
+            // Apply logic operator
+            switch (lgc)
+            {
+                    // clang-format off
+                case logic::ltrue: stack.push(true);  break;
+                case logic::lor:   stack.apply_or();  break;
+                case logic::land:  stack.apply_and(); break;
+                case logic::lnot:  stack.apply_not(); break;
+                default:           CELER_ASSERT_UNREACHABLE();
+            }
+            // clang-format on
+        }
+        i = short_circuit(logic, ends, i, stack.top());
+    }
+    CELER_ENSURE(stack.size() == 1);
+    CELER_ENSURE(!result.face || result.face.id() < vol.num_faces());
+    result.inside = stack.top();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Skip operands whose value can't change the top of the stack.
+ *
+ * In postfix notation, if the token at \c i starts a complete subexpression
+ * that is immediately followed by a binary operator, that operator combines
+ * the subexpression with the current top of the stack. If the top value
+ * already determines the result of the operator, the subexpression and
+ * operator are skipped, leaving the top value unchanged. This repeats for
+ * chains such as <code>a b & c & d &</code>.
+ *
+ * The position of the operator following each operand is calculated when the
+ * geometry is built, so each check and each skip take constant time.
+ */
+CELER_FUNCTION size_type SenseLogicEvaluator::short_circuit(
+    SpanConstLogic logic, SpanConstLogic ends, size_type i, bool top)
+{
+    logic_int const skip_op = top ? logic::lor : logic::land;
+    while (i < logic.size())
+    {
+        size_type const j = ends[i];
+        if (j == logic.size() || logic[j] != skip_op)
+        {
+            // Next operand must be evaluated
+            return i;
+        }
+        // Skip the operand and the operator that combines it with the top
+        i = j + 1;
+    }
+    return i;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
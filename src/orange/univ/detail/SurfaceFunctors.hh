@@ -13,6 +13,7 @@
 #include "corecel/math/ArrayUtils.hh"
 #include "corecel/math/NumericLimits.hh"
 
+#include "SafetyBoundCalculator.hh"
 #include "Types.hh"
 
 namespace celeritas
@@ -63,7 +64,8 @@ struct CalcNormal
  *
  * For certain surface types (spheres, cylinders, planes), defined such that
  * the normal is *outward* (positive when "outside", negative when "inside"),
- * the nearest distance to the surface can be calculated quite trivially.
+ * the nearest distance to the surface can be calculated quite trivially. Other
+ * surfaces return a conservative lower bound from \c SafetyBoundCalculator .
  */
 struct CalcSafetyDistance
 {
@@ -73,11 +75,11 @@ struct CalcSafetyDistance
     template<class S>
     CELER_FUNCTION real_type operator()(S const& surf)
     {
-        if (!S::simple_safety())
+        if constexpr (!S::simple_safety())
         {
             // Not a surface that satisfies our simplifying constraints: return
             // a conservative answer.
-            return 0;
+            return SafetyBoundCalculator{this->pos}(surf);
         }
 
         // Calculate outward normal
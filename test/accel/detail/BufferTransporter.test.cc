@@ -0,0 +1,271 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/BufferTransporter.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/BufferTransporter.hh"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/global/Stepper.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Step tracks with a fixed lifetime through a small number of slots.
+ *
+ * The primary energy (in MeV) is the number of steps the track takes. Tracks
+ * with an even ID produce a secondary when they are killed, so the number of
+ * pending initializers can grow during stepping. Exceeding the initializer
+ * capacity is an error, as it is in the real stepper.
+ */
+class MockStepper final : public StepperInterface
+{
+  public:
+    MockStepper(size_type num_slots, size_type init_capacity)
+        : slots_(num_slots), init_capacity_{init_capacity}
+    {
+    }
+
+    void warm_up() final {}
+
+    StepperResult operator()() final { return this->step(); }
+
+    StepperResult operator()(SpanConstPrimary primaries) final
+    {
+        for (Primary const& p : primaries)
+        {
+            queue_.push_back(
+                {static_cast<size_type>(p.energy.value()),
+                 p.track_id.get() % 2 == 0 ? secondary_steps : 0});
+        }
+        CELER_VALIDATE(queue_.size() <= init_capacity_,
+                       << "insufficient initializer capacity");
+        auto result = this->step();
+        result.generated = primaries.size();
+        return result;
+    }
+
+    void reseed(EventId) final {}
+
+    ActionSequenceT const& actions() const final
+    {
+        CELER_ASSERT_UNREACHABLE();
+    }
+
+    CoreStateInterface const& state() const final
+    {
+        CELER_ASSERT_UNREACHABLE();
+    }
+
+    SPState sp_state() final { CELER_ASSERT_UNREACHABLE(); }
+
+    //// ACCESSORS ////
+
+    size_type queued() const { return queue_.size(); }
+    size_type num_iters() const { return num_iters_; }
+    size_type num_track_steps() const { return num_track_steps_; }
+    size_type num_killed() const { return num_killed_; }
+
+  private:
+    struct Track
+    {
+        size_type remaining{};
+        size_type secondary{};
+    };
+
+    static constexpr size_type secondary_steps = 3;
+
+    std::vector<Track> slots_;
+    std::deque<Track> queue_;
+    size_type init_capacity_;
+    size_type num_iters_{};
+    size_type num_track_steps_{};
+    size_type num_killed_{};
+
+    StepperResult step()
+    {
+        StepperResult result;
+        for (Track& t : slots_)
+        {
+            if (!t.remaining && !queue_.empty())
+            {
+                t = queue_.front();
+                queue_.pop_front();
+            }
+        }
+        for (Track& t : slots_)
+        {
+            if (!t.remaining)
+            {
+                continue;
+            }
+            ++result.active;
+            ++num_track_steps_;
+            if (--t.remaining > 0)
+            {
+                ++result.alive;
+                continue;
+            }
+            ++num_killed_;
+            if (t.secondary)
+            {
+                queue_.push_back({t.secondary, 0});
+            }
+        }
+        CELER_VALIDATE(queue_.size() <= init_capacity_,
+                       << "insufficient initializer capacity");
+        result.queued = queue_.size();
+        ++num_iters_;
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+class BufferTransporterTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecPrimary = BufferTransporter::VecPrimary;
+
+    static constexpr size_type num_slots = 4;
+    static constexpr size_type buffer_size = 8;
+    static constexpr size_type init_capacity = 12;
+    static constexpr size_type num_buffers = 5;
+
+    void SetUp() override
+    {
+        inp_.max_steps = 1000;
+        inp_.buffer_size = buffer_size;
+        inp_.init_capacity = init_capacity;
+    }
+
+    // Make a buffer of primaries with varying lifetimes
+    VecPrimary make_buffer()
+    {
+        VecPrimary result(buffer_size);
+        for (Primary& p : result)
+        {
+            p.energy = units::MevEnergy(1 + track_counter_ % 7);
+            p.track_id = TrackId{track_counter_++};
+            p.event_id = EventId{0};
+        }
+        return result;
+    }
+
+    BufferTransporter::Input inp_;
+    size_type track_counter_{0};
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(BufferTransporterTest, full)
+{
+    auto step = std::make_shared<MockStepper>(num_slots, init_capacity);
+    BufferTransporter transport{step, inp_, nullptr};
+    EXPECT_FALSE(transport.partial());
+
+    for ([[maybe_unused]] auto i : range(num_buffers))
+    {
+        auto buffer = this->make_buffer();
+        transport.flush(&buffer);
+        EXPECT_TRUE(buffer.empty());
+        EXPECT_FALSE(transport.tracks_active());
+        EXPECT_EQ(0, transport.step_iters());
+        EXPECT_EQ(0, step->queued());
+    }
+    EXPECT_EQ(60, step->num_killed());
+    EXPECT_EQ(215, step->num_track_steps());
+    EXPECT_EQ(62, step->num_iters());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(BufferTransporterTest, partial_flush)
+{
+    inp_.flush_steps = 2;
+    auto step = std::make_shared<MockStepper>(num_slots, init_capacity);
+    BufferTransporter transport{step, inp_, nullptr};
+    EXPECT_TRUE(transport.partial());
+
+    std::vector<size_type> flush_iters;
+    size_type prev_iters = 0;
+    for ([[maybe_unused]] auto i : range(num_buffers))
+    {
+        auto buffer = this->make_buffer();
+        transport.partial_flush(&buffer);
+        EXPECT_TRUE(buffer.empty());
+
+        // Tracks are carried over to the next buffer
+        ASSERT_TRUE(transport.tracks_active());
+        flush_iters.push_back(transport.step_iters() - prev_iters);
+        prev_iters = transport.step_iters();
+
+        // Stepping stops only once there's room for the next buffer
+        EXPECT_LE(step->queued() + buffer_size, init_capacity);
+    }
+    // Stepping continues past the limit while initializers are too full
+    static size_type const expected_flush_iters[] = {2u, 15u, 6u, 16u, 6u};
+    EXPECT_VEC_EQ(expected_flush_iters, flush_iters);
+
+    // The final flush completes the remaining tracks
+    VecPrimary empty;
+    transport.flush(&empty);
+    EXPECT_FALSE(transport.tracks_active());
+    EXPECT_EQ(0, transport.step_iters());
+    EXPECT_EQ(0, step->queued());
+
+    // All tracks complete with the same number of steps as a full flush, but
+    // with fewer step iterations since the track slots stay occupied
+    EXPECT_EQ(60, step->num_killed());
+    EXPECT_EQ(215, step->num_track_steps());
+    EXPECT_EQ(55, step->num_iters());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(BufferTransporterTest, partial_completion)
+{
+    // A partial flush that completes all tracks resets the step counter
+    inp_.flush_steps = 100;
+    auto step = std::make_shared<MockStepper>(num_slots, init_capacity);
+    BufferTransporter transport{step, inp_, nullptr};
+
+    auto buffer = this->make_buffer();
+    transport.partial_flush(&buffer);
+    EXPECT_FALSE(transport.tracks_active());
+    EXPECT_EQ(0, transport.step_iters());
+    EXPECT_EQ(12, step->num_killed());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(BufferTransporterTest, max_steps)
+{
+    // The step limit counts iterations since the state was last empty
+    inp_.flush_steps = 2;
+    inp_.max_steps = 20;
+    auto step = std::make_shared<MockStepper>(num_slots, init_capacity);
+    BufferTransporter transport{step, inp_, nullptr};
+
+    for ([[maybe_unused]] auto i : range(2))
+    {
+        auto buffer = this->make_buffer();
+        transport.partial_flush(&buffer);
+    }
+    EXPECT_EQ(17, transport.step_iters());
+    VecPrimary empty;
+    EXPECT_THROW(transport.flush(&empty), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -8,12 +8,14 @@
 #include "accel/detail/HitProcessor.hh"
 
 #include <G4ParticleTable.hh>
+#include <G4VSensitiveDetector.hh>
 
 #include "geocel/UnitUtils.hh"
 #include "celeritas/SimpleCmsTestBase.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/user/DetectorSteps.hh"
 #include "celeritas/user/StepData.hh"
+#include "accel/BatchHitInterface.hh"
 #include "accel/SDTestBase.hh"
 #include "accel/SimpleSensitiveDetector.hh"
 
@@ -30,6 +32,47 @@ namespace detail
 namespace test
 {
 
+//---------------------------------------------------------------------------//
+/*!
+ * Record batches of hits, and the number of hits another detector has seen.
+ */
+class BatchSensitiveDetector final : public G4VSensitiveDetector,
+                                     public BatchHitInterface
+{
+  public:
+    explicit BatchSensitiveDetector(SimpleSensitiveDetector const* other)
+        : G4VSensitiveDetector("batch"), other_{other}
+    {
+        CELER_EXPECT(other_);
+    }
+
+    void ProcessHits(DetectorStepOutput const& steps,
+                     SpanConstIndex indices) final
+    {
+        batch_sizes.push_back(indices.size());
+        other_hits.push_back(other_->hits().energy_deposition.size());
+        for (size_type i : indices)
+        {
+            track_id.push_back(steps.track_id[i].unchecked_get());
+            energy_deposition.push_back(steps.energy_deposition[i].value());
+        }
+    }
+
+    std::vector<size_type> batch_sizes;
+    std::vector<size_type> other_hits;
+    std::vector<size_type> track_id;
+    std::vector<real_type> energy_deposition;
+
+  protected:
+    bool ProcessHits(G4Step*, G4TouchableHistory*) final
+    {
+        CELER_ASSERT_UNREACHABLE();
+    }
+
+  private:
+    SimpleSensitiveDetector const* other_;
+};
+
 //---------------------------------------------------------------------------//
 class SimpleCmsTest : public ::celeritas::test::SDTestBase,
                       public ::celeritas::test::SimpleCmsTestBase
@@ -239,6 +282,138 @@ TEST_F(SimpleCmsTest, no_touchable)
     }
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, batch_detector)
+{
+    // Temporarily replace the EM calorimeter SD with a batch detector
+    this->geometry();
+    auto* em_lv = const_cast<G4LogicalVolume*>(
+        this->detectors().at("em_calorimeter")->lv());
+    BatchSensitiveDetector batch_sd{this->detectors().at("si_tracker")};
+    struct RestoreSD
+    {
+        G4LogicalVolume* lv;
+        G4VSensitiveDetector* sd;
+        ~RestoreSD() { lv->SetSensitiveDetector(sd); }
+    } restore_sd{em_lv, em_lv->GetSensitiveDetector()};
+    em_lv->SetSensitiveDetector(&batch_sd);
+
+    HitProcessor process_hits = this->make_hit_processor();
+
+    // Interleave steps in the tracker (2), EM (0), and hadronic (1)
+    // calorimeters
+    DetectorStepOutput dso;
+    dso.detector = {
+        DetectorId{2},
+        DetectorId{0},
+        DetectorId{1},
+        DetectorId{0},
+        DetectorId{2},
+    };
+    dso.track_id = {
+        TrackId{0},
+        TrackId{1},
+        TrackId{2},
+        TrackId{3},
+        TrackId{4},
+    };
+    dso.energy_deposition = {
+        MevEnergy{0.1},
+        MevEnergy{0.2},
+        MevEnergy{0.3},
+        MevEnergy{0.4},
+        MevEnergy{0.5},
+    };
+    dso.points[StepPoint::post].time.assign(5, 1e-9 * units::second);
+    dso.points[StepPoint::pre].pos = {
+        from_cm(Real3{100, 0, 0}),
+        from_cm(Real3{0, 150, 10}),
+        from_cm(Real3{0, 200, -20}),
+        from_cm(Real3{0, -150, 10}),
+        from_cm(Real3{-100, 0, 0}),
+    };
+    dso.particle = {
+        ParticleId{2},
+        ParticleId{1},
+        ParticleId{0},
+        ParticleId{1},
+        ParticleId{2},
+    };
+    process_hits(dso);
+
+    // Batch detector gets its steps in a single call, in step order, and
+    // before the other detectors
+    static size_type const expected_batch_sizes[] = {2u};
+    EXPECT_VEC_EQ(expected_batch_sizes, batch_sd.batch_sizes);
+    static size_type const expected_other_hits[] = {0u};
+    EXPECT_VEC_EQ(expected_other_hits, batch_sd.other_hits);
+    static size_type const expected_track_id[] = {1u, 3u};
+    EXPECT_VEC_EQ(expected_track_id, batch_sd.track_id);
+    static real_type const expected_batch_edep[] = {0.2, 0.4};
+    EXPECT_VEC_SOFT_EQ(expected_batch_edep, batch_sd.energy_deposition);
+
+    // Plain detectors are called once per step, in step order
+    static real_type const expected_si_edep[] = {0.1, 0.5};
+    EXPECT_VEC_SOFT_EQ(expected_si_edep,
+                       this->get_hits("si_tracker").energy_deposition);
+    static real_type const expected_had_edep[] = {0.3};
+    EXPECT_VEC_SOFT_EQ(expected_had_edep,
+                       this->get_hits("had_calorimeter").energy_deposition);
+    EXPECT_TRUE(this->get_hits("em_calorimeter").energy_deposition.empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, deferred)
+{
+    HitProcessor process_hits = this->make_hit_processor();
+    std::vector<HitProcessor::Task> pending;
+    process_hits.defer_hits(
+        [&pending](HitProcessor::Task task) { pending.push_back(task); });
+
+    // Hits are copied and handed to the dispatcher rather than sent
+    auto dso_hits = this->make_dso();
+    process_hits(dso_hits);
+    dso_hits.energy_deposition = {
+        MevEnergy{0.4},
+        MevEnergy{0.5},
+        MevEnergy{0.6},
+    };
+    process_hits(dso_hits);
+    ASSERT_EQ(2, pending.size());
+    EXPECT_TRUE(this->get_hits("si_tracker").energy_deposition.empty());
+
+    // Running the tasks delivers hits in order from the copied data
+    dso_hits = {};
+    for (auto& task : pending)
+    {
+        task();
+    }
+    pending.clear();
+    static real_type const expected_si_edep[] = {0.1, 0.4};
+    EXPECT_VEC_SOFT_EQ(expected_si_edep,
+                       this->get_hits("si_tracker").energy_deposition);
+    static real_type const expected_had_edep[] = {0.3, 0.6};
+    EXPECT_VEC_SOFT_EQ(expected_had_edep,
+                       this->get_hits("had_calorimeter").energy_deposition);
+
+    // Buffers from completed tasks are reused for later steps
+    dso_hits = this->make_dso();
+    dso_hits.energy_deposition[0] = MevEnergy{0.7};
+    process_hits(dso_hits);
+    ASSERT_EQ(1, pending.size());
+    pending.front()();
+    pending.clear();
+    static real_type const expected_reused_edep[] = {0.1, 0.4, 0.7};
+    EXPECT_VEC_SOFT_EQ(expected_reused_edep,
+                       this->get_hits("si_tracker").energy_deposition);
+
+    // Clearing the dispatcher sends hits immediately
+    process_hits.defer_hits({});
+    process_hits(this->make_dso());
+    EXPECT_TRUE(pending.empty());
+    EXPECT_EQ(4, this->get_hits("si_tracker").energy_deposition.size());
+}
+
 //---------------------------------------------------------------------------//
 TEST_F(SimpleCmsTest, touchable_midvol)
 {
@@ -0,0 +1,213 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadWriter.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/OffloadWriter.hh"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Save written events in memory, optionally failing on a given event.
+ */
+class RecordingWriter final : public EventWriterInterface
+{
+  public:
+    using VecEvent = std::vector<VecPrimary>;
+
+    RecordingWriter(VecEvent* events, size_type fail_event = size_type(-1))
+        : events_{events}, fail_event_{fail_event}
+    {
+        CELER_EXPECT(events_);
+    }
+
+    void operator()(argument_type primaries) final
+    {
+        CELER_EXPECT(!primaries.empty());
+        if (primaries.front().event_id.get() == fail_event_)
+        {
+            throw std::runtime_error("disk full");
+        }
+        events_->push_back(primaries);
+    }
+
+  private:
+    VecEvent* events_;
+    size_type fail_event_;
+};
+
+//---------------------------------------------------------------------------//
+class OffloadWriterTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecPrimary = EventWriterInterface::VecPrimary;
+    using VecEvent = RecordingWriter::VecEvent;
+
+    static constexpr size_type num_streams = 4;
+    static constexpr size_type num_events = 64;
+
+    // Make primaries for an event
+    static VecPrimary make_event(size_type event)
+    {
+        VecPrimary result(1 + event % 5);
+        for (auto i : range(result.size()))
+        {
+            Primary& p = result[i];
+            p.particle_id = ParticleId{static_cast<size_type>(i % 3)};
+            p.energy = units::MevEnergy(1 + event + 0.5 * i);
+            p.position = {real_type(i), real_type(event), 0};
+            p.direction = {0, 0, 1};
+            p.time = 0.25 * event;
+            p.event_id = EventId{event};
+            p.track_id = TrackId{static_cast<size_type>(i)};
+        }
+        return result;
+    }
+
+    // Write events round-robin from one thread per stream
+    static void write_threaded(OffloadWriter& write)
+    {
+        std::vector<std::thread> threads;
+        for (auto s : range(num_streams))
+        {
+            threads.emplace_back([&write, s] {
+                for (size_type e = s; e < num_events; e += num_streams)
+                {
+                    write(make_event(e));
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+
+    static size_type event_of(VecPrimary const& primaries)
+    {
+        return primaries.front().event_id.get();
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadWriterTest, matches_synchronous)
+{
+    // Write synchronously
+    VecEvent expected;
+    {
+        RecordingWriter write{&expected};
+        for (auto e : range(num_events))
+        {
+            write(make_event(e));
+        }
+    }
+
+    // Write through the background thread from all streams
+    VecEvent actual;
+    {
+        OffloadWriter write{std::make_unique<RecordingWriter>(&actual),
+                            num_streams};
+        write_threaded(write);
+        write.finalize();
+    }
+    ASSERT_EQ(expected.size(), actual.size());
+
+    // Events from each stream are written in order
+    std::vector<size_type> last_event(num_streams, 0);
+    std::vector<bool> seen(num_streams, false);
+    for (auto const& primaries : actual)
+    {
+        auto e = event_of(primaries);
+        auto s = e % num_streams;
+        EXPECT_TRUE(!seen[s] || last_event[s] < e) << "event " << e;
+        seen[s] = true;
+        last_event[s] = e;
+    }
+
+    // The written events are identical regardless of order
+    std::sort(actual.begin(),
+              actual.end(),
+              [](VecPrimary const& a, VecPrimary const& b) {
+                  return event_of(a) < event_of(b);
+              });
+    for (auto e : range(num_events))
+    {
+        auto const& exp = expected[e];
+        auto const& act = actual[e];
+        ASSERT_EQ(exp.size(), act.size());
+        for (auto i : range(exp.size()))
+        {
+            EXPECT_EQ(exp[i].particle_id, act[i].particle_id);
+            EXPECT_EQ(exp[i].energy.value(), act[i].energy.value());
+            EXPECT_VEC_EQ(exp[i].position, act[i].position);
+            EXPECT_VEC_EQ(exp[i].direction, act[i].direction);
+            EXPECT_EQ(exp[i].time, act[i].time);
+            EXPECT_EQ(exp[i].event_id, act[i].event_id);
+            EXPECT_EQ(exp[i].track_id, act[i].track_id);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadWriterTest, destructor_flushes)
+{
+    // Remaining events are written when the writer is destroyed
+    VecEvent actual;
+    {
+        OffloadWriter write{std::make_unique<RecordingWriter>(&actual),
+                            num_streams};
+        write_threaded(write);
+    }
+    EXPECT_EQ(num_events, actual.size());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadWriterTest, error)
+{
+    VecEvent actual;
+    OffloadWriter write{std::make_unique<RecordingWriter>(&actual, 3),
+                        num_streams};
+
+    // The failure is reported once: by a later write, or else by finalize
+    EXPECT_THROW(
+        {
+            for (auto e : range(1000))
+            {
+                write(make_event(e));
+                std::this_thread::yield();
+            }
+            write.finalize();
+        },
+        std::runtime_error);
+    EXPECT_NO_THROW(write.finalize());
+
+    // Events before the failure are still written
+    EXPECT_TRUE(std::none_of(
+        actual.begin(), actual.end(), [](VecPrimary const& primaries) {
+            return event_of(primaries) == 3;
+        }));
+    EXPECT_LE(3, actual.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
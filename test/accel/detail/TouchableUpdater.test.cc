@@ -49,6 +49,23 @@ namespace test
 class TouchableUpdaterTest : public ::celeritas::test::GeantGeoTestBase
 {
   protected:
+    //! Navigator that counts relocations
+    class CountingNavigator final : public G4Navigator
+    {
+      public:
+        void LocateGlobalPointAndUpdateTouchable(G4ThreeVector const& pos,
+                                                 G4ThreeVector const& dir,
+                                                 G4VTouchable* touchable,
+                                                 G4bool relative) final
+        {
+            ++num_located;
+            G4Navigator::LocateGlobalPointAndUpdateTouchable(
+                pos, dir, touchable, relative);
+        }
+
+        size_type num_located{0};
+    };
+
     void SetUp() override
     {
         auto const& geo = *this->geometry();
@@ -76,15 +93,18 @@ class TouchableUpdaterTest : public ::celeritas::test::GeantGeoTestBase
         return TouchableUpdater{&navi_, touch_handle_()};
     }
 
+    //! Number of times the navigator has located a point
+    size_type num_located() const { return navi_.num_located; }
+
   private:
-    G4Navigator navi_;
+    CountingNavigator navi_;
     G4TouchableHandle touch_handle_;
 };
 
 TEST_F(TouchableUpdaterTest, correct)
 {
     TouchableUpdater update = this->make_touchable_updater();
-    auto update_cm = [&](Real3 const& pos_cm, std ::string lv_name) {
+    auto update_cm = [&](Real3 const& pos_cm, std::string lv_name) {
         return update(from_cm(pos_cm), Real3{1, 0, 0}, this->find_lv(lv_name));
     };
 
@@ -93,6 +113,27 @@ TEST_F(TouchableUpdaterTest, correct)
     EXPECT_TRUE(update_cm({150, 0, 0}, "em_calorimeter"));
 }
 
+TEST_F(TouchableUpdaterTest, same_volume)
+{
+    TouchableUpdater update = this->make_touchable_updater();
+    auto update_cm = [&](Real3 const& pos_cm, std::string lv_name) {
+        return update(from_cm(pos_cm), Real3{1, 0, 0}, this->find_lv(lv_name));
+    };
+
+    // Consecutive points in the same volume are located only once
+    EXPECT_TRUE(update_cm({150, 0, 0}, "em_calorimeter"));
+    EXPECT_EQ(1, this->num_located());
+    EXPECT_TRUE(update_cm({0, 160, 0}, "em_calorimeter"));
+    EXPECT_TRUE(update_cm({-170, 0, 10}, "em_calorimeter"));
+    EXPECT_EQ(1, this->num_located());
+
+    // Points in other volumes must still be located
+    EXPECT_TRUE(update_cm({200, 0, 0}, "had_calorimeter"));
+    EXPECT_EQ(2, this->num_located());
+    EXPECT_TRUE(update_cm({100, 0, 0}, "si_tracker"));
+    EXPECT_EQ(3, this->num_located());
+}
+
 TEST_F(TouchableUpdaterTest, just_inside)
 {
     TouchableUpdater update = this->make_touchable_updater();
@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/TransportWorker.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/TransportWorker.hh"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(TransportWorkerTest, ordering)
+{
+    std::thread::id worker_id;
+    std::vector<int> done;
+    {
+        TransportWorker worker(
+            [&worker_id] { worker_id = std::this_thread::get_id(); }, 4);
+        for (int i : range(10))
+        {
+            worker.push([&done, i] { done.push_back(i); });
+        }
+        worker.wait();
+        EXPECT_NE(std::this_thread::get_id(), worker_id);
+
+        // The same thread is reused for later batches
+        worker.push([&done, &worker_id] {
+            EXPECT_EQ(worker_id, std::this_thread::get_id());
+            done.push_back(10);
+        });
+        worker.wait();
+    }
+    static int const expected_done[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_VEC_EQ(expected_done, done);
+}
+
+TEST(TransportWorkerTest, owner_tasks)
+{
+    constexpr size_type max_pending = 3;
+    auto const owner_id = std::this_thread::get_id();
+    std::vector<int> delivered;
+    TransportWorker worker({}, max_pending);
+
+    // Send many more "hits" back to the owner than can be pending
+    worker.push([&] {
+        for (int i : range(20))
+        {
+            worker.call_owner([&delivered, owner_id, i] {
+                EXPECT_EQ(owner_id, std::this_thread::get_id());
+                delivered.push_back(i);
+            });
+        }
+    });
+
+    // Tasks are run by the owner, in order, while waiting
+    worker.wait();
+    ASSERT_EQ(20, delivered.size());
+    for (int i : range(20))
+    {
+        EXPECT_EQ(i, delivered[i]);
+    }
+
+    // Tasks sent from the owner itself run immediately
+    worker.call_owner([&delivered] { delivered.push_back(-1); });
+    EXPECT_EQ(-1, delivered.back());
+
+    // Polling runs whatever has been sent back so far
+    worker.push([&] { worker.call_owner([&] { delivered.push_back(100); }); });
+    while (delivered.back() != 100)
+    {
+        worker.poll();
+        std::this_thread::yield();
+    }
+    worker.wait();
+    EXPECT_EQ(22, delivered.size());
+}
+
+TEST(TransportWorkerTest, exceptions)
+{
+    std::vector<int> done;
+    TransportWorker worker({}, 1);
+    worker.push([&done] { done.push_back(1); });
+    worker.push([] { throw std::runtime_error("transport failed"); });
+    worker.push([&done] { done.push_back(2); });
+    EXPECT_THROW(worker.wait(), std::runtime_error);
+
+    // Tasks after the failure are discarded, and the worker is still usable
+    static int const expected_done[] = {1};
+    EXPECT_VEC_EQ(expected_done, done);
+    EXPECT_NO_THROW(worker.wait());
+    worker.push([&done] { done.push_back(3); });
+    worker.wait();
+    EXPECT_EQ(3, done.back());
+
+    // Initialization failures are also propagated
+    TransportWorker bad_init([] { throw std::runtime_error("no device"); }, 1);
+    EXPECT_THROW(bad_init.wait(), std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
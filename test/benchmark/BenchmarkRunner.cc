@@ -0,0 +1,176 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/BenchmarkRunner.cc
+//---------------------------------------------------------------------------//
+#include "BenchmarkRunner.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Config.hh"
+#include "corecel/Version.hh"
+
+#include "corecel/io/ColorUtils.hh"
+#include "corecel/sys/Environment.hh"
+
+namespace celeritas
+{
+namespace test
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Maximum number of iterations in a batch
+constexpr size_type max_iterations = 1000000000u;
+
+//---------------------------------------------------------------------------//
+//! All results from this executable
+std::vector<BenchmarkResult>& results()
+{
+    static std::vector<BenchmarkResult> result;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the name of the currently running test.
+ */
+std::string current_test_name()
+{
+    auto const* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    if (!info)
+    {
+        return {};
+    }
+    return std::string{info->test_suite_name()} + "." + info->name();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all results in the Google Benchmark JSON format.
+ */
+void write_results(std::string const& filename)
+{
+    auto context = nlohmann::json::object({
+        {"library_version", std::string(celeritas_version)},
+        {"library_build_type", std::string(celeritas_build_type)},
+        {"host_name", std::string(celeritas_hostname)},
+        {"real_type", std::string(celeritas_real_type)},
+        {"core_geo", std::string(celeritas_core_geo)},
+        {"debug", bool(CELERITAS_DEBUG)},
+    });
+
+    auto benchmarks = nlohmann::json::array();
+    for (auto const& r : results())
+    {
+        benchmarks.push_back({
+            {"name", r.name},
+            {"run_name", r.name},
+            {"run_type", "iteration"},
+            {"iterations", r.iterations},
+            {"real_time", r.real_time},
+            {"cpu_time", r.cpu_time},
+            {"time_unit", "ns"},
+        });
+    }
+
+    std::ofstream outf(filename);
+    CELER_VALIDATE(outf,
+                   << "failed to open benchmark output file at '" << filename
+                   << "'");
+    outf << nlohmann::json::object({{"context", std::move(context)},
+                                    {"benchmarks", std::move(benchmarks)}})
+                .dump(1)
+         << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the minimum time per benchmark from the environment.
+ */
+BenchmarkRunner::BenchmarkRunner()
+    : BenchmarkRunner([] {
+        std::string const& str = celeritas::getenv("CELER_BENCHMARK_MIN_TIME");
+        return str.empty() ? 0.1 : std::stod(str);
+    }())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with an explicit minimum time per benchmark [s].
+ */
+BenchmarkRunner::BenchmarkRunner(double min_time) : min_time_(min_time)
+{
+    CELER_VALIDATE(min_time_ > 0,
+                   << "invalid minimum benchmark time " << min_time_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the number of iterations for the next batch.
+ *
+ * This returns the same number of iterations if the batch was long enough.
+ */
+size_type
+BenchmarkRunner::next_iterations(size_type iters, double elapsed) const
+{
+    if (elapsed >= min_time_ || iters >= max_iterations)
+    {
+        return iters;
+    }
+
+    // Overshoot the estimate slightly, growing by a factor between 2 and 10
+    double multiplier = 10;
+    if (elapsed > 0)
+    {
+        multiplier = std::clamp(1.4 * min_time_ / elapsed, 2.0, 10.0);
+    }
+    return static_cast<size_type>(std::min<double>(
+        std::ceil(iters * multiplier), static_cast<double>(max_iterations)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Print and save the result.
+ */
+void BenchmarkRunner::record(BenchmarkResult const& result)
+{
+    BenchmarkResult r = result;
+    if (auto test_name = current_test_name(); !test_name.empty())
+    {
+        r.name = test_name + "/" + r.name;
+    }
+
+    std::cout << color_code('x') << std::left << std::setw(60) << r.name
+              << color_code(' ') << std::right << std::setw(12)
+              << std::setprecision(4) << r.real_time << " ns"
+              << std::setw(12) << r.cpu_time << " ns" << std::setw(12)
+              << r.iterations << std::endl;
+
+    results().push_back(std::move(r));
+
+    if (std::string const& filename = celeritas::getenv("CELER_BENCHMARK_OUT");
+        !filename.empty())
+    {
+        // Rewrite the file with all results so far
+        write_results(filename);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
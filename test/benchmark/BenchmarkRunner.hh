@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/BenchmarkRunner.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <ctime>
+#include <string>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Stopwatch.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Timing result for a single benchmark.
+ *
+ * Times are per iteration in nanoseconds.
+ */
+struct BenchmarkResult
+{
+    std::string name;
+    size_type iterations{0};
+    double real_time{0};
+    double cpu_time{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time a host function by repeatedly calling it.
+ *
+ * The number of iterations is increased geometrically until a batch takes at
+ * least the minimum time, and the per-iteration times of the final batch are
+ * reported. The minimum time defaults to 0.1 s and can be changed with the \c
+ * CELER_BENCHMARK_MIN_TIME environment variable.
+ *
+ * Each result is printed and recorded with the name of the current test
+ * prepended. If the \c CELER_BENCHMARK_OUT environment variable is set, all
+ * results from the executable are written to that file in the JSON format
+ * used by Google Benchmark so that its \c compare.py tool can diff results
+ * between releases.
+ *
+ * \code
+    BenchmarkRunner run;
+    run("ten_mev", [&] { do_not_optimize(interact(rng)); });
+   \endcode
+ */
+class BenchmarkRunner
+{
+  public:
+    // Construct with the minimum time per benchmark from the environment
+    BenchmarkRunner();
+
+    // Construct with an explicit minimum time per benchmark [s]
+    explicit BenchmarkRunner(double min_time);
+
+    // Time a function
+    template<class F>
+    inline BenchmarkResult operator()(std::string const& name, F&& func) const;
+
+  private:
+    double min_time_;
+
+    // Calculate the number of iterations for the next batch
+    size_type next_iterations(size_type iters, double elapsed) const;
+
+    // Print and save the result
+    static void record(BenchmarkResult const& result);
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Prevent the compiler from optimizing away a computed value.
+ */
+template<class T>
+inline void do_not_optimize(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static char const volatile* sink;
+    sink = reinterpret_cast<char const volatile*>(&value);
+    (void)sink;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Time a function.
+ */
+template<class F>
+BenchmarkResult
+BenchmarkRunner::operator()(std::string const& name, F&& func) const
+{
+    BenchmarkResult result;
+    result.name = name;
+
+    size_type iters = 1;
+    while (true)
+    {
+        std::clock_t const cpu_start = std::clock();
+        Stopwatch get_time;
+        for (size_type i = 0; i < iters; ++i)
+        {
+            func();
+        }
+        double const elapsed = get_time();
+        double const cpu_elapsed = static_cast<double>(std::clock() - cpu_start)
+                                   / CLOCKS_PER_SEC;
+
+        size_type next_iters = this->next_iterations(iters, elapsed);
+        if (next_iters == iters)
+        {
+            result.iterations = iters;
+            result.real_time = elapsed * 1e9 / iters;
+            result.cpu_time = cpu_elapsed * 1e9 / iters;
+            break;
+        }
+        iters = next_iters;
+    }
+
+    BenchmarkRunner::record(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,73 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/celeritas/em/KleinNishinaInteractor.bench.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/em/interactor/KleinNishinaInteractor.hh"
+
+#include "celeritas/Quantities.hh"
+#include "celeritas/phys/InteractorHostTestBase.hh"
+
+#include "BenchmarkRunner.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class KleinNishinaInteractorBenchmark : public InteractorHostTestBase
+{
+  protected:
+    void SetUp() override
+    {
+        auto const& params = *this->particle_params();
+        data_.ids.electron = params.find(pdg::electron());
+        data_.ids.gamma = params.find(pdg::gamma());
+        data_.inv_electron_mass
+            = 1 / (params.get(data_.ids.electron).mass().value());
+
+        this->set_inc_direction({0, 0, 1});
+        this->resize_secondaries(1024);
+    }
+
+    KleinNishinaData data_;
+    BenchmarkRunner run;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(KleinNishinaInteractorBenchmark, sample)
+{
+    struct Case
+    {
+        char const* label;
+        real_type energy;
+    };
+
+    for (Case c : {Case{"100keV", 0.1}, Case{"10MeV", 10}, Case{"1GeV", 1000}})
+    {
+        this->set_inc_particle(pdg::gamma(), MevEnergy{c.energy});
+        KleinNishinaInteractor interact(data_,
+                                        this->particle_track(),
+                                        this->direction(),
+                                        this->secondary_allocator());
+        auto& allocate = this->secondary_allocator();
+        auto& rng = this->rng();
+
+        run(c.label, [&] {
+            if (allocate.size() == allocate.capacity())
+            {
+                allocate.clear();
+            }
+            do_not_optimize(interact(rng));
+        });
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,116 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/celeritas/em/UrbanMsc.bench.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/em/msc/UrbanMsc.hh"
+
+#include <string>
+
+#include "celeritas/em/MscTestBase.hh"
+#include "celeritas/em/msc/detail/UrbanMscMinimalStepLimit.hh"
+#include "celeritas/em/msc/detail/UrbanMscSafetyStepLimit.hh"
+#include "celeritas/em/params/UrbanMscParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+
+#include "BenchmarkRunner.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class UrbanMscBenchmark : public MscTestBase
+{
+  protected:
+    using Algorithm = MscStepLimitAlgorithm;
+
+    void SetUp() override
+    {
+        msc_params_ = UrbanMscParams::from_import(
+            *this->particle(), *this->material(), this->imported_data());
+        ASSERT_TRUE(msc_params_);
+    }
+
+    // Time the step limit for an electron in steel
+    void run_step_limit(Algorithm alg, bool on_boundary);
+
+    std::shared_ptr<UrbanMscParams const> msc_params_;
+    BenchmarkRunner run;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time the step limit for an electron in steel.
+ */
+void UrbanMscBenchmark::run_step_limit(Algorithm alg, bool on_boundary)
+{
+    using detail::UrbanMscHelper;
+    using detail::UrbanMscMinimalStepLimit;
+    using detail::UrbanMscSafetyStepLimit;
+
+    auto const& msc_params = msc_params_->host_ref();
+    auto phys_params = this->physics()->host_ref();
+    phys_params.scalars.step_limit_algorithm = alg;
+
+    for (real_type energy : {0.1, 10.0})
+    {
+        auto par = this->make_par_view(pdg::electron(), MevEnergy{energy});
+        auto phys
+            = this->make_phys_view(par, "G4_STAINLESS-STEEL", phys_params);
+        UrbanMscHelper helper(msc_params, par, phys);
+        auto& rng = this->rng();
+        real_type const safety = 0;
+        real_type const step = phys.dedx_range();
+
+        std::string label = to_cstring(alg);
+        label += (on_boundary ? "_boundary_" : "_interior_");
+        label += (energy < 1 ? "100keV" : "10MeV");
+
+        if (alg == Algorithm::minimal)
+        {
+            run(label, [&] {
+                UrbanMscMinimalStepLimit calc_limit(
+                    msc_params, helper, &phys, on_boundary, step);
+                do_not_optimize(calc_limit(rng));
+            });
+        }
+        else
+        {
+            run(label, [&] {
+                UrbanMscSafetyStepLimit calc_limit(msc_params,
+                                                   helper,
+                                                   par.energy(),
+                                                   &phys,
+                                                   phys.material_id(),
+                                                   on_boundary,
+                                                   safety,
+                                                   step);
+                do_not_optimize(calc_limit(rng));
+            });
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(UrbanMscBenchmark, step_limit)
+{
+    for (auto alg :
+         {Algorithm::minimal, Algorithm::safety, Algorithm::safety_plus})
+    {
+        for (bool on_boundary : {false, true})
+        {
+            this->run_step_limit(alg, on_boundary);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,157 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/celeritas/field/FieldPropagator.bench.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/field/FieldPropagator.hh"
+
+#include <fstream>
+
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/CoreGeoTestBase.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/field/DormandPrinceStepper.hh"
+#include "celeritas/field/FieldDriverOptions.hh"
+#include "celeritas/field/FieldTestBase.hh"
+#include "celeritas/field/HelixDormandPrinceStepper.hh"
+#include "celeritas/field/MagFieldEquation.hh"
+#include "celeritas/field/MakeMagFieldPropagator.hh"
+#include "celeritas/field/RZMapField.hh"
+#include "celeritas/field/RZMapFieldInput.hh"
+#include "celeritas/field/RZMapFieldParams.hh"
+#include "celeritas/field/UniformZField.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "BenchmarkRunner.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class FieldPropagatorBenchmark : public CoreGeoTestBase, public FieldTestBase
+{
+  protected:
+    std::string geometry_basename() const override { return "two-boxes"; }
+
+    SPConstGeo build_geometry() final
+    {
+        return this->build_geometry_from_basename();
+    }
+
+    SPConstParticle build_particle() const final
+    {
+        using namespace constants;
+        using namespace units;
+        ParticleParams::Input defs = {{"electron",
+                                       pdg::electron(),
+                                       MevMass{0.5109989461},
+                                       ElementaryCharge{-1},
+                                       stable_decay_constant}};
+        return std::make_shared<ParticleParams>(std::move(defs));
+    }
+
+    BenchmarkRunner run;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Propagate around a circular orbit inside the inner box.
+ *
+ * The 10.9 MeV electron has a radius of 3.8 cm in the 1 T field.
+ */
+TEST_F(FieldPropagatorBenchmark, dormand_prince_interior)
+{
+    UniformZField field(1.0 * units::tesla);
+    FieldDriverOptions driver_options;
+
+    for (real_type step : {1e-2, 1.0})
+    {
+        auto particle = this->make_particle_view(pdg::electron(),
+                                                 MevEnergy{10.9181415106});
+        auto geo = this->make_geo_track_view({3.8085385437789383, 0, 0},
+                                             {0, 1, 0});
+        auto propagate = make_mag_field_propagator<DormandPrinceStepper>(
+            field, driver_options, particle, geo);
+
+        run(step < 1 ? "short" : "long",
+            [&] { do_not_optimize(propagate(step)); });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Propagate around an orbit that repeatedly crosses the inner box.
+ *
+ * The 17.5 MeV electron has a radius of 6 cm, so it enters and exits the inner
+ * box (half-width 5 cm) four times per orbit.
+ */
+TEST_F(FieldPropagatorBenchmark, dormand_prince_crossing)
+{
+    UniformZField field(1.0 * units::tesla);
+    FieldDriverOptions driver_options;
+
+    auto particle
+        = this->make_particle_view(pdg::electron(), MevEnergy{17.483});
+    auto geo = this->make_geo_track_view({6, 0, 0}, {0, 1, 0});
+    auto propagate = make_mag_field_propagator<DormandPrinceStepper>(
+        field, driver_options, particle, geo);
+
+    run("crossing", [&] {
+        auto result = propagate(1.0);
+        if (result.boundary)
+        {
+            geo.cross_boundary();
+        }
+        do_not_optimize(result);
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Propagate inside the inner box in a CMS-like R-Z field map.
+ */
+TEST_F(FieldPropagatorBenchmark, dormand_prince_rzmap)
+{
+    RZMapFieldParams field_map = [this] {
+        RZMapFieldInput inp;
+        std::ifstream(this->test_data_path("celeritas", "cms-tiny.field.json"))
+            >> inp;
+        return RZMapFieldParams(inp);
+    }();
+    RZMapField field(field_map.host_ref());
+    FieldDriverOptions driver_options;
+
+    run("field", [&] { do_not_optimize(field({1, 2, 3})); });
+
+    auto particle
+        = this->make_particle_view(pdg::electron(), MevEnergy{10.9181415106});
+    auto geo = this->make_geo_track_view({1, 0, 0}, {0, 1, 0});
+    auto propagate = make_mag_field_propagator<DormandPrinceStepper>(
+        field, driver_options, particle, geo);
+
+    run("propagate", [&] { do_not_optimize(propagate(0.1)); });
+
+    // Use the helix where the field is uniform
+    auto helix_propagate = make_field_propagator(
+        HelixDormandPrinceStepper{
+            MagFieldEquation<RZMapField const&>{field, particle.charge()},
+            real_type{1e-4}},
+        driver_options,
+        particle,
+        geo);
+
+    run("propagate-helix", [&] { do_not_optimize(helix_propagate(0.1)); });
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/celeritas/grid/XsCalculator.bench.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/grid/XsCalculator.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "celeritas/grid/CalculatorTestBase.hh"
+
+#include "BenchmarkRunner.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class XsCalculatorBenchmark : public CalculatorTestBase
+{
+  protected:
+    using Energy = XsCalculator::Energy;
+
+    static constexpr size_type num_samples = 1024;
+
+    void SetUp() override
+    {
+        // Log-uniform sample energies, including some outside the grid
+        std::mt19937 rng;
+        std::uniform_real_distribution<real_type> sample_loge(
+            std::log(real_type{1e-4}), std::log(real_type{1e9}));
+        energies.resize(num_samples);
+        for (auto& e : energies)
+        {
+            e = Energy{std::exp(sample_loge(rng))};
+        }
+    }
+
+    std::vector<Energy> energies;
+    BenchmarkRunner run;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(XsCalculatorBenchmark, calc)
+{
+    for (size_type count : {16, 128, 1024})
+    {
+        this->build(1e-3, 1e8, count);
+        this->set_prime_index(count / 2);
+        XsCalculator calc_xs(this->data(), this->values());
+
+        size_type i = 0;
+        run(std::to_string(count), [&] {
+            do_not_optimize(calc_xs(energies[i++ % num_samples]));
+        });
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
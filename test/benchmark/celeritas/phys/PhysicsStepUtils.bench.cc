@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/celeritas/phys/PhysicsStepUtils.bench.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/PhysicsStepUtils.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/MockTestBase.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+
+#include "BenchmarkRunner.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class PhysicsStepUtilsBenchmark : public MockTestBase
+{
+    using Base = MockTestBase;
+
+  protected:
+    using MaterialStateStore
+        = CollectionStateStore<MaterialStateData, MemSpace::host>;
+    using ParticleStateStore
+        = CollectionStateStore<ParticleStateData, MemSpace::host>;
+    using PhysicsStateStore
+        = CollectionStateStore<PhysicsStateData, MemSpace::host>;
+    using MevEnergy = units::MevEnergy;
+
+    static constexpr size_type num_samples = 1024;
+
+    PhysicsOptions build_physics_options() const override
+    {
+        return PhysicsOptions{};
+    }
+
+    void SetUp() override
+    {
+        Base::SetUp();
+
+        mat_state = MaterialStateStore(this->material()->host_ref(), 1);
+        par_state = ParticleStateStore(this->particle()->host_ref(), 1);
+        phys_state = PhysicsStateStore(this->physics()->host_ref(), 1);
+    }
+
+    //! Time the step limit calculation over a range of energies
+    void run_step_limit(char const* name, MaterialId mid)
+    {
+        MaterialTrackView material(
+            this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
+        material = MaterialTrackView::Initializer_t{mid};
+
+        ParticleTrackView particle(
+            this->particle()->host_ref(), par_state.ref(), TrackSlotId{0});
+        ParticleTrackView::Initializer_t par_init;
+        par_init.particle_id = this->particle()->find(name);
+        CELER_ASSERT(par_init.particle_id);
+        par_init.energy = MevEnergy{1};
+        particle = par_init;
+
+        PhysicsTrackView physics(this->physics()->host_ref(),
+                                 phys_state.ref(),
+                                 particle.particle_id(),
+                                 material.material_id(),
+                                 TrackSlotId{0});
+        physics = PhysicsTrackInitializer{};
+        physics.interaction_mfp(1);
+        PhysicsStepView pstep{
+            this->physics()->host_ref(), phys_state.ref(), TrackSlotId{0}};
+
+        // Log-uniform energies over the range of the mock processes
+        std::mt19937 rng;
+        std::uniform_real_distribution<real_type> sample_loge(
+            std::log(real_type{1e-3}), std::log(real_type{100}));
+        std::vector<MevEnergy> energies(num_samples);
+        for (auto& e : energies)
+        {
+            e = MevEnergy{std::exp(sample_loge(rng))};
+        }
+
+        size_type i = 0;
+        run(name, [&] {
+            particle.energy(energies[i++ % num_samples]);
+            do_not_optimize(
+                calc_physics_step_limit(material, particle, physics, pstep));
+        });
+    }
+
+    MaterialStateStore mat_state;
+    ParticleStateStore par_state;
+    PhysicsStateStore phys_state;
+    BenchmarkRunner run;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(PhysicsStepUtilsBenchmark, calc_physics_step_limit)
+{
+    this->run_step_limit("gamma", MaterialId{2});
+    this->run_step_limit("celeriton", MaterialId{2});
+    this->run_step_limit("anti-celeriton", MaterialId{2});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,121 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file benchmark/orange/univ/SimpleUnitTracker.bench.cc
+//---------------------------------------------------------------------------//
+#include "orange/univ/SimpleUnitTracker.hh"
+
+#include <random>
+#include <vector>
+
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/OrangeGeoTestBase.hh"
+#include "orange/OrangeParams.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
+
+#include "BenchmarkRunner.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class SimpleUnitTrackerBenchmark : public OrangeGeoTestBase
+{
+  protected:
+    using LocalState = ::celeritas::detail::LocalState;
+
+    static constexpr size_type num_samples = 1024;
+
+    // Sample initialized states uniformly in the bounding box
+    std::vector<LocalState> sample_states(SimpleUnitTracker const& tracker);
+
+    // Time intersection and safety calculations in the global unit
+    void run_tracker();
+
+    BenchmarkRunner run;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample initialized states uniformly in the bounding box.
+ */
+auto SimpleUnitTrackerBenchmark::sample_states(
+    SimpleUnitTracker const& tracker) -> std::vector<LocalState>
+{
+    auto const& hsref = this->host_state();
+    LocalState state;
+    state.temp_sense = hsref.temp_sense[AllItems<Sense>{}];
+    auto face_storage = hsref.temp_face[AllItems<FaceId>{}];
+    state.temp_next.face = face_storage.data();
+    state.temp_next.distance
+        = hsref.temp_distance[AllItems<real_type>{}].data();
+    state.temp_next.isect = hsref.temp_isect[AllItems<size_type>{}].data();
+    state.temp_next.size = face_storage.size();
+
+    std::mt19937 rng;
+    auto const& bbox = this->params().bbox();
+    UniformBoxDistribution<> sample_box{bbox.lower(), bbox.upper()};
+    IsotropicDistribution<> sample_isotropic;
+
+    std::vector<LocalState> result;
+    while (result.size() < num_samples)
+    {
+        state.pos = sample_box(rng);
+        state.dir = sample_isotropic(rng);
+        state.volume = {};
+        state.surface = {};
+        auto init = tracker.initialize(state);
+        if (!init.volume || init.surface)
+        {
+            continue;
+        }
+        state.volume = init.volume;
+        result.push_back(state);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time intersection and safety calculations in the global unit.
+ */
+void SimpleUnitTrackerBenchmark::run_tracker()
+{
+    SimpleUnitTracker tracker(this->host_params(), SimpleUnitId{0});
+    auto states = this->sample_states(tracker);
+
+    size_type i = 0;
+    run("intersect",
+        [&] { do_not_optimize(tracker.intersect(states[i++ % num_samples])); });
+    run("intersect_max", [&] {
+        do_not_optimize(tracker.intersect(states[i++ % num_samples], 0.1));
+    });
+    run("safety", [&] {
+        auto const& s = states[i++ % num_samples];
+        do_not_optimize(tracker.safety(s.pos, s.volume));
+    });
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleUnitTrackerBenchmark, five_volumes)
+{
+    this->build_geometry("five-volumes.org.json");
+    this->run_tracker();
+}
+
+TEST_F(SimpleUnitTrackerBenchmark, field_layers)
+{
+    this->build_geometry("field-layers.org.json");
+    this->run_tracker();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
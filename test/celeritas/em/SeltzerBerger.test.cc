@@ -86,7 +86,8 @@ class SeltzerBergerTest : public InteractorHostTestBase
                                                    *this->particle_params(),
                                                    *this->material_params(),
                                                    this->imported_processes(),
-                                                   read_element_data);
+                                                   read_element_data,
+                                                   false);
         data_ = model_->host_ref();
 
         // Set cutoffs
@@ -309,6 +310,88 @@ TEST_F(SeltzerBergerTest, sb_energy_dist)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
+TEST_F(SeltzerBergerTest, sb_energy_dist_cdf)
+{
+    // Rebuild the model with the tabulated sampling envelope
+    std::string data_path = this->test_data_path("celeritas", "");
+    SeltzerBergerModel model(ActionId{0},
+                             *this->particle_params(),
+                             *this->material_params(),
+                             this->imported_processes(),
+                             SeltzerBergerReader{data_path.c_str()},
+                             true);
+    auto const& xs = model.host_ref().differential_xs;
+    ASSERT_TRUE(xs.elements[ElementId{0}].has_cdf());
+    EXPECT_FALSE(
+        model_->host_ref().differential_xs.elements[ElementId{0}].has_cdf());
+
+    MevEnergy const gamma_cutoff{0.0009};
+    int const num_samples = 8192;
+    std::vector<real_type> avg_exit_frac;
+    std::vector<real_type> avg_engine_samples;
+
+    auto sample_many = [&](real_type inc_energy, auto& sample_energy) {
+        real_type total_exit_energy = 0;
+        RandomEngine& rng_engine = this->rng();
+        for (int i = 0; i < num_samples; ++i)
+        {
+            Energy exit_gamma = sample_energy(rng_engine);
+            EXPECT_GT(exit_gamma.value(), gamma_cutoff.value());
+            EXPECT_LT(exit_gamma.value(), inc_energy);
+            total_exit_energy += exit_gamma.value();
+        }
+
+        avg_exit_frac.push_back(total_exit_energy / (num_samples * inc_energy));
+        avg_engine_samples.push_back(real_type(rng_engine.count())
+                                     / num_samples);
+    };
+
+    ParticleParams const& pp = *this->particle_params();
+    for (real_type inc_energy : {0.001, 0.0045, 0.567, 7.89, 89.0, 901.})
+    {
+        SBEnergyDistHelper edist_helper(
+            xs,
+            Energy{inc_energy},
+            ElementId{0},
+            this->density_correction(MaterialId{0}, Energy{inc_energy}),
+            gamma_cutoff);
+        ASSERT_TRUE(edist_helper.has_envelope());
+        {
+            SBEnergyDistribution<SBElectronXsCorrector> sample_energy(
+                edist_helper, {});
+            sample_many(inc_energy, sample_energy);
+        }
+        {
+            SBEnergyDistribution<SBPositronXsCorrector> sample_energy(
+                edist_helper,
+                {pp.get(pp.find(pdg::positron())).mass(),
+                 this->material_params()->get(ElementId{0}),
+                 gamma_cutoff,
+                 Energy{inc_energy}});
+            sample_many(inc_energy, sample_energy);
+        }
+    }
+
+    // Exit fractions should statistically match those of \c sb_energy_dist,
+    // but almost every sample (two random numbers, each from two engine
+    // samples) is accepted on the first try unless the positron correction
+    // dominates
+    // clang-format off
+    static real_type const expected_avg_exit_frac[] = {0.94898691828581,
+        0.90271163740914, 0.49838754546276, 0.27700860326957,
+        0.082274412562091, 0.070686367179978, 0.062521884218662,
+        0.06440459536393, 0.076423311661269, 0.077162946793344,
+        0.085250490068144, 0.088492490354347};
+    static real_type const expected_avg_engine_samples[] = {4.0205078125,
+        135.22998046875, 4.00634765625, 15.5478515625, 4.11376953125,
+        4.26611328125, 4.07421875, 4.0849609375, 4.0498046875,
+        4.04931640625, 4.03662109375, 4.0380859375};
+    // clang-format on
+
+    EXPECT_VEC_SOFT_EQ(expected_avg_exit_frac, avg_exit_frac);
+    EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
+}
+
 TEST_F(SeltzerBergerTest, basic)
 {
     // Reserve 4 secondaries, one for each sample
@@ -16,6 +16,8 @@
 #include "celeritas/Quantities.hh"
 #include "celeritas/Units.hh"
 #include "celeritas/field/DormandPrinceStepper.hh"
+#include "celeritas/field/HelixDormandPrinceStepper.hh"
+#include "celeritas/field/HelixStepper.hh"
 #include "celeritas/field/MagFieldEquation.hh"
 #include "celeritas/field/MakeMagFieldPropagator.hh"
 #include "celeritas/field/RungeKuttaStepper.hh"
@@ -169,6 +171,101 @@ TEST_F(SteppersTest, host_dormand_prince_547)
 
     // Test the Dormand-Prince 547(M) stepper
     this->run_stepper<UniformField, DormandPrinceStepper>(field);
-}  //---------------------------------------------------------------------------//
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SteppersTest, host_general_helix)
+{
+    // Construct a uniform magnetic field
+    UniformField field({0, 0, param.field_value});
+
+    // Test the analytical helix stepper
+    this->run_stepper<UniformField, HelixStepper>(field);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SteppersTest, tilted_helix)
+{
+    // Field along an arbitrary axis
+    real_type const b = param.field_value / std::sqrt(real_type(14));
+    UniformField field({1 * b, 2 * b, 3 * b});
+    units::ElementaryCharge charge{-1};
+
+    OdeState start;
+    start.pos = {1, -2, 3};
+    start.mom = {param.momentum_z, param.momentum_y, -param.momentum_z};
+
+    // Take one long analytic step and many small integrated steps
+    real_type const step = 5;
+    auto helix_step = make_mag_field_stepper<HelixStepper>(field, charge);
+    auto helix = helix_step(step, start);
+
+    auto rk_step = make_mag_field_stepper<DormandPrinceStepper>(field, charge);
+    OdeState state = start;
+    int const num_substeps = 500;
+    for ([[maybe_unused]] int i : range(num_substeps))
+    {
+        state = rk_step(step / num_substeps, state).end_state;
+    }
+
+    EXPECT_VEC_NEAR(state.pos, helix.end_state.pos, real_type{1e-8});
+    EXPECT_VEC_NEAR(state.mom, helix.end_state.mom, real_type{1e-8});
+    EXPECT_SOFT_EQ(norm(start.mom), norm(helix.end_state.mom));
+    EXPECT_SOFT_EQ(norm(start.mom), norm(helix.mid_state.mom));
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SteppersTest, helix_dormand_prince)
+{
+    using Equation_t = MagFieldEquation<UniformField const&>;
+    units::ElementaryCharge charge{-1};
+    OdeState start;
+    start.pos = {param.radius, 0, 0};
+    start.mom = {0, param.momentum_y, param.momentum_z};
+    real_type const step = 1;
+
+    {
+        // Uniform field should use the exact helix
+        UniformField field({0, 0, param.field_value});
+        HelixDormandPrinceStepper stepper{Equation_t{field, charge}, 1e-4};
+        auto result = stepper(step, start);
+        auto expected = HelixStepper{Equation_t{field, charge}}(step, start);
+        EXPECT_VEC_EQ(expected.end_state.pos, result.end_state.pos);
+        EXPECT_VEC_EQ(expected.end_state.mom, result.end_state.mom);
+    }
+    {
+        // Slightly nonuniform field has an added error estimate
+        struct GradientField
+        {
+            real_type b;
+            Real3 operator()(Real3 const& pos) const
+            {
+                return {0, 0, b * (1 + real_type(1e-6) * pos[0])};
+            }
+        };
+        GradientField field{param.field_value};
+        HelixDormandPrinceStepper stepper{
+            MagFieldEquation<GradientField const&>{field, charge}, 1e-4};
+        auto result = stepper(step, start);
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_LT(1e-10, result.err_state.pos[i]);
+            EXPECT_GT(1e-7, result.err_state.pos[i]);
+            EXPECT_LT(1e-10, result.err_state.mom[i] / norm(start.mom));
+        }
+
+        // Tighter tolerance should use the Runge-Kutta integrator
+        auto rk_step
+            = make_mag_field_stepper<DormandPrinceStepper>(field, charge);
+        HelixDormandPrinceStepper rk_stepper{
+            MagFieldEquation<GradientField const&>{field, charge}, 1e-8};
+        auto expected = rk_step(step, start);
+        result = rk_stepper(step, start);
+        EXPECT_VEC_EQ(expected.end_state.pos, result.end_state.pos);
+        EXPECT_VEC_EQ(expected.end_state.mom, result.end_state.mom);
+    }
+}
+
+//---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -56,6 +56,12 @@ TEST_F(RangeCalculatorTest, all)
     EXPECT_SOFT_EQ(500, calc_range(Energy{1e4}));
     // Above range
     EXPECT_SOFT_EQ(500, calc_range(Energy{1.001e4}));
+
+    // Precalculated log energy
+    for (real_type e : {1.0, 20.0, 1.001e4})
+    {
+        EXPECT_EQ(calc_range(Energy{e}), calc_range(Energy{e}, std::log(e)));
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/grid/ValueGridBuilder.hh"
 
+#include <cmath>
 #include <memory>
 #include <vector>
 
@@ -123,6 +124,50 @@ TEST_F(ValueGridBuilderTest, log_grid)
     }
 }
 
+TEST_F(ValueGridBuilderTest, joined_log_grid)
+{
+    using Builder_t = ValueGridLogBuilder;
+
+    VecBuilder entries;
+    {
+        // Same spacing, meeting at a grid point
+        Builder_t lower(1e1, 1e3, VeDbl{.1, .2, .3});
+        Builder_t upper(1e3, 1e5, VeDbl{3, 4, 5});
+        entries.push_back(Builder_t::from_joined(lower, upper, 1e3));
+    }
+    {
+        // Finer spacing below, overlapping grids
+        Builder_t lower(1e1, 1e4, VeDbl{1, 2, 3, 4, 5, 6, 7});
+        Builder_t upper(1e2, 1e4, VeDbl{10, 20, 30});
+        entries.push_back(Builder_t::from_joined(lower, upper, 1e3));
+    }
+
+    // Build
+    this->build(entries);
+
+    // Test results using the physics calculator
+    ASSERT_EQ(2, grid_storage.size());
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{0}], real_ref);
+        EXPECT_EQ(5, grid_storage[XsIndex{0}].value.size());
+        EXPECT_SOFT_EQ(0.1, calc_xs(Energy{1e1}));
+        EXPECT_SOFT_EQ(0.2, calc_xs(Energy{1e2}));
+        EXPECT_SOFT_EQ(3, calc_xs(Energy{1e3}));
+        EXPECT_SOFT_EQ(4, calc_xs(Energy{1e4}));
+        EXPECT_SOFT_EQ(5, calc_xs(Energy{1e5}));
+    }
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{1}], real_ref);
+        EXPECT_EQ(7, grid_storage[XsIndex{1}].value.size());
+        EXPECT_SOFT_EQ(1, calc_xs(Energy{1e1}));
+        EXPECT_SOFT_EQ(4, calc_xs(Energy{std::sqrt(1e2 * 1e3)}));
+        EXPECT_SOFT_EQ(20, calc_xs(Energy{1e3}));
+        EXPECT_SOFT_EQ(22.402530733520423,
+                       calc_xs(Energy{std::sqrt(1e3 * 1e4)}));
+        EXPECT_SOFT_EQ(30, calc_xs(Energy{1e4}));
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
@@ -141,6 +142,53 @@ TEST_F(XsCalculatorTest, scaled_middle)
     EXPECT_SOFT_EQ(1e4, value_as<Energy>(calc.energy_max()));
 }
 
+TEST_F(XsCalculatorTest, log_energy)
+{
+    this->build(0.1, 1e4, 6);
+    this->set_prime_index(3);
+
+    XsCalculator calc(this->data(), this->values());
+
+    // Results with a precalculated log energy should be identical
+    for (real_type e : {0.0001, 0.1, 0.2, 5.0, 1e2, 1e4, 1e5})
+    {
+        EXPECT_EQ(calc(Energy{e}), calc(Energy{e}, std::log(e)));
+    }
+}
+
+TEST_F(XsCalculatorTest, compact)
+{
+    this->build(0.1, 1e4, 6);
+    this->set_prime_index(3);
+    auto xs = this->mutable_values();
+    std::fill(xs.begin(), xs.begin() + 3, 1.0 / 3);
+
+    // Store a copy of the values in single precision
+    Collection<float, Ownership::value, MemSpace::host> storage;
+    XsGridRecord<float> grid;
+    grid.log_energy = this->data().log_energy;
+    grid.prime_index = this->data().prime_index;
+    std::vector<float> values(xs.begin(), xs.end());
+    grid.value = make_builder(&storage).insert_back(values.begin(),
+                                                     values.end());
+    Collection<float, Ownership::const_reference, MemSpace::host> storage_ref;
+    storage_ref = storage;
+
+    XsCalculator calc(this->data(), this->values());
+    CompactXsCalculator calc_compact(grid, storage_ref);
+
+    // Grid values are rounded, but interpolation is at full precision
+    EXPECT_EQ(static_cast<real_type>(values[0]), calc_compact[0]);
+    EXPECT_SOFT_NEAR(calc[5], calc_compact[5], 1e-6);
+    for (real_type e : {0.0001, 0.1, 0.2, 5.0, 1e2, 1e4, 1e5})
+    {
+        EXPECT_SOFT_NEAR(calc(Energy{e}), calc_compact(Energy{e}), 1e-6)
+            << "at E=" << e;
+    }
+    EXPECT_SOFT_EQ(0.1, value_as<Energy>(calc_compact.energy_min()));
+    EXPECT_SOFT_EQ(1e4, value_as<Energy>(calc_compact.energy_max()));
+}
+
 TEST_F(XsCalculatorTest, scaled_highest)
 {
     // values of 1, 10, 100 --> actual xs = {1, 10, 1}
@@ -0,0 +1,145 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/MappedEventIO.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/MappedEventReader.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+
+#include "celeritas/io/MappedEventWriter.hh"
+#include "celeritas/io/detail/MappedEventFormat.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "EventIOTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class MappedEventIOTest : public EventIOTestBase
+{
+};
+
+TEST_F(MappedEventIOTest, write_read)
+{
+    std::string filename = this->make_unique_filename(".celprim");
+
+    // Write events
+    {
+        MappedEventWriter write_event(filename, this->particles());
+        this->write_test_event(write_event);
+    }
+
+    MappedEventReader reader(filename, this->particles());
+    EXPECT_EQ(3, reader.num_events());
+    this->read_check_test_event(reader);
+}
+
+TEST_F(MappedEventIOTest, random_access)
+{
+    std::string filename = this->make_unique_filename(".celprim");
+    {
+        MappedEventWriter write_event(filename, this->particles());
+        this->write_test_event(write_event);
+    }
+
+    MappedEventReader const reader(filename, this->particles());
+    auto event = reader(EventId{2});
+    ASSERT_EQ(1, event.size());
+    EXPECT_EQ(EventId{2}, event.front().event_id);
+    EXPECT_EQ(TrackId{0}, event.front().track_id);
+
+    event = reader(EventId{1});
+    ASSERT_EQ(5, event.size());
+    EXPECT_SOFT_EQ(3.45, event.back().energy.value());
+    EXPECT_EQ(TrackId{4}, event.back().track_id);
+
+    // Views into the same event share storage
+    EXPECT_EQ(event.data(), reader(EventId{1}).data());
+}
+
+TEST_F(MappedEventIOTest, mismatched_particles)
+{
+    std::string filename = this->make_unique_filename(".celprim");
+    {
+        MappedEventWriter write_event(filename, this->particles());
+        this->write_test_event(write_event);
+    }
+
+    using namespace constants;
+    auto other = std::make_shared<ParticleParams>(ParticleParams::Input{
+        {"gamma",
+         pdg::gamma(),
+         zero_quantity(),
+         zero_quantity(),
+         stable_decay_constant},
+    });
+    EXPECT_THROW(MappedEventReader(filename, other), RuntimeError);
+}
+
+TEST_F(MappedEventIOTest, corrupt_header)
+{
+    std::string filename = this->make_unique_filename(".celprim");
+    {
+        MappedEventWriter write_event(filename, this->particles());
+        this->write_test_event(write_event);
+    }
+
+    // Event count too large for an event ID
+    {
+        std::fstream f(filename,
+                       std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(offsetof(detail::MappedEventHeader, num_events));
+        std::uint64_t num_events = std::uint64_t{1} << 40;
+        f.write(reinterpret_cast<char const*>(&num_events),
+                sizeof(num_events));
+    }
+    EXPECT_THROW(MappedEventReader(filename, this->particles()),
+                 RuntimeError);
+}
+
+TEST_F(MappedEventIOTest, corrupt_index)
+{
+    std::string filename = this->make_unique_filename(".celprim");
+    {
+        MappedEventWriter write_event(filename, this->particles());
+        this->write_test_event(write_event);
+    }
+
+    std::uint64_t index_offset{};
+    {
+        std::ifstream f(filename, std::ios::binary);
+        f.seekg(offsetof(detail::MappedEventHeader, index_offset));
+        f.read(reinterpret_cast<char*>(&index_offset), sizeof(index_offset));
+    }
+    auto write_offset = [&](size_type event, std::uint64_t offset) {
+        std::fstream f(filename,
+                       std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(index_offset + event * sizeof(std::uint64_t));
+        f.write(reinterpret_cast<char const*>(&offset), sizeof(offset));
+    };
+
+    // Offsets that decrease
+    write_offset(1, 100);
+    EXPECT_THROW(MappedEventReader(filename, this->particles()),
+                 RuntimeError);
+
+    // Final offset past the end of the primary data (would overflow the
+    // data size check)
+    write_offset(1, 1);
+    write_offset(3, std::uint64_t{1} << 62);
+    EXPECT_THROW(MappedEventReader(filename, this->particles()),
+                 RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
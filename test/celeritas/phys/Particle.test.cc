@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "Particle.test.hh"
 
+#include <cmath>
+#include <limits>
+
 #include "corecel/Config.hh"
 
 #include "corecel/cont/Array.hh"
@@ -178,6 +181,7 @@ TEST_F(ParticleTestHost, electron)
     particle = Initializer_t{ParticleId{0}, MevEnergy{0.5}};
 
     EXPECT_REAL_EQ(0.5, particle.energy().value());
+    EXPECT_SOFT_EQ(std::log(0.5), particle.log_energy());
     EXPECT_REAL_EQ(0.5109989461, particle.mass().value());
     EXPECT_REAL_EQ(-1., particle.charge().value());
     EXPECT_REAL_EQ(0.0, particle.decay_constant());
@@ -194,9 +198,16 @@ TEST_F(ParticleTestHost, electron)
     EXPECT_FALSE(particle.is_stopped());
     particle.subtract_energy(MevEnergy{0.25});
     EXPECT_REAL_EQ(0.25, particle.energy().value());
+    EXPECT_SOFT_EQ(std::log(0.25), particle.log_energy());
+    particle.subtract_energy(zero_quantity());
+    EXPECT_SOFT_EQ(std::log(0.25), particle.log_energy());
+    particle.energy(MevEnergy{2});
+    EXPECT_SOFT_EQ(std::log(2.0), particle.log_energy());
     particle.energy(zero_quantity());
     EXPECT_TRUE(particle.is_stopped());
     EXPECT_REAL_EQ(0.0, particle.energy().value());
+    EXPECT_EQ(-std::numeric_limits<real_type>::infinity(),
+              particle.log_energy());
 }
 
 TEST_F(ParticleTestHost, positron)
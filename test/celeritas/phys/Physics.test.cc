@@ -11,6 +11,7 @@
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/sys/ActionRegistry.hh"
 #include "geocel/UnitUtils.hh"
 #include "celeritas/MockTestBase.hh"
 #include "celeritas/em/process/EPlusAnnihilationProcess.hh"
@@ -141,10 +142,167 @@ TEST_F(PhysicsParamsTest, output)
         GTEST_SKIP() << "Test results are based on CGS units";
     }
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"physics","models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":231,"value_grid_ids":89,"value_grids":89,"value_tables":35}})json",
+        R"json({"_category":"internal","_label":"physics","models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"compact_grids":0,"compact_reals":0,"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":231,"value_grid_ids":89,"value_grids":89,"value_tables":35}})json",
         to_string(out));
 }
 
+TEST_F(PhysicsParamsTest, cache)
+{
+    std::string cache_file = this->make_unique_filename(".bin");
+
+    // Rebuild physics with the same processes but new models and actions
+    auto build = [&](std::size_t key) {
+        ActionRegistry action_reg;
+        PhysicsParams::Input inp;
+        inp.particles = this->particle();
+        inp.materials = this->material();
+        for (auto process_id :
+             range(ProcessId{this->physics()->num_processes()}))
+        {
+            inp.processes.push_back(this->physics()->process(process_id));
+        }
+        inp.action_registry = &action_reg;
+        inp.options = this->build_physics_options();
+        inp.cache_file = cache_file;
+        inp.cache_key = key;
+        return std::make_shared<PhysicsParams>(std::move(inp));
+    };
+
+    auto get_reals = [](PhysicsParams const& p) {
+        auto reals = p.host_ref().reals[AllItems<real_type>{}];
+        return std::vector<real_type>(reals.begin(), reals.end());
+    };
+    auto expected_reals = get_reals(*this->physics());
+
+    // Write the cache and read it back
+    auto built = build(1);
+    auto loaded = build(1);
+    EXPECT_VEC_EQ(expected_reals, get_reals(*built));
+    EXPECT_VEC_EQ(expected_reals, get_reals(*loaded));
+    EXPECT_EQ(this->physics()->host_ref().value_grids.size(),
+              loaded->host_ref().value_grids.size());
+    EXPECT_EQ(this->physics()->host_ref().model_xs.size(),
+              loaded->host_ref().model_xs.size());
+
+    // Rebuild (and overwrite the cache) for different inputs
+    auto rebuilt = build(2);
+    EXPECT_VEC_EQ(expected_reals, get_reals(*rebuilt));
+
+    // Failing to write the cache isn't fatal
+    cache_file = this->make_unique_filename("-missing") + "/physics.bin";
+    auto uncached = build(3);
+    EXPECT_VEC_EQ(expected_reals, get_reals(*uncached));
+}
+
+TEST_F(PhysicsParamsTest, compact_tables)
+{
+    std::string cache_file = this->make_unique_filename(".bin");
+
+    auto build = [&] {
+        ActionRegistry action_reg;
+        PhysicsParams::Input inp;
+        inp.particles = this->particle();
+        inp.materials = this->material();
+        for (auto process_id :
+             range(ProcessId{this->physics()->num_processes()}))
+        {
+            inp.processes.push_back(this->physics()->process(process_id));
+        }
+        inp.action_registry = &action_reg;
+        inp.options = this->build_physics_options();
+        inp.options.compact_tables = true;
+        inp.cache_file = cache_file;
+        return std::make_shared<PhysicsParams>(std::move(inp));
+    };
+
+    auto const& expected = this->physics()->host_ref();
+    auto get_values = [](auto const& data, ItemRange<real_type> r) {
+        auto values = data.reals[r];
+        return std::vector<real_type>(values.begin(), values.end());
+    };
+
+    // Build and write the cache, then load it back
+    for (auto const& physics : {build(), build()})
+    {
+        auto const& actual = physics->host_ref();
+        EXPECT_EQ(95, actual.reals.size());
+        EXPECT_EQ(56, actual.compact_reals.size());
+
+        // Cross sections are stored in single precision; other grids are
+        // deduplicated
+        ASSERT_EQ(expected.value_grids.size(), actual.value_grids.size());
+        ASSERT_EQ(expected.value_grids.size(), actual.compact_grids.size());
+        size_type num_compact{0};
+        for (auto id : range(ValueGridId{expected.value_grids.size()}))
+        {
+            auto expected_values
+                = get_values(expected, expected.value_grids[id].value);
+            if (auto const& grid = actual.compact_grids[id])
+            {
+                EXPECT_FALSE(actual.value_grids[id]);
+                auto values = actual.compact_reals[grid.value];
+                EXPECT_VEC_EQ(std::vector<float>(expected_values.begin(),
+                                                 expected_values.end()),
+                              std::vector<float>(values.begin(), values.end()));
+                ++num_compact;
+            }
+            else
+            {
+                EXPECT_VEC_EQ(expected_values,
+                              get_values(actual, actual.value_grids[id].value));
+            }
+        }
+        EXPECT_EQ(32, num_compact);
+
+        ASSERT_EQ(expected.integral_xs.size(), actual.integral_xs.size());
+        for (auto id :
+             range(ItemId<IntegralXsProcess>{expected.integral_xs.size()}))
+        {
+            EXPECT_VEC_EQ(
+                get_values(expected, expected.integral_xs[id].energy_max_xs),
+                get_values(actual, actual.integral_xs[id].energy_max_xs));
+        }
+        ASSERT_EQ(expected.model_groups.size(), actual.model_groups.size());
+        for (auto id : range(ItemId<ModelGroup>{expected.model_groups.size()}))
+        {
+            EXPECT_VEC_EQ(
+                get_values(expected, expected.model_groups[id].energy),
+                get_values(actual, actual.model_groups[id].energy));
+        }
+    }
+
+    // Tabulated cross sections are interpolated from the compact storage
+    using StateStore = CollectionStateStore<PhysicsStateData, MemSpace::host>;
+    auto physics = build();
+    StateStore expected_state(expected, 1);
+    StateStore state(physics->host_ref(), 1);
+    for (auto pid : range(ParticleId{this->particle()->size()}))
+    {
+        for (auto mat_id : range(MaterialId{this->material()->size()}))
+        {
+            PhysicsTrackView const expected_phys(
+                expected, expected_state.ref(), pid, mat_id, TrackSlotId{0});
+            PhysicsTrackView const phys(physics->host_ref(),
+                                        state.ref(),
+                                        pid,
+                                        mat_id,
+                                        TrackSlotId{0});
+            auto material = this->material()->get(mat_id);
+            for (auto ppid :
+                 range(ParticleProcessId{phys.num_particle_processes()}))
+            {
+                for (real_type energy : {1e-5, 1e-3, 0.1, 10.0, 1e3})
+                {
+                    MevEnergy e{energy};
+                    EXPECT_SOFT_NEAR(expected_phys.calc_xs(ppid, material, e),
+                                     phys.calc_xs(ppid, material, e),
+                                     1e-6);
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (HOST)
 //---------------------------------------------------------------------------//
@@ -459,6 +459,135 @@ TEST_F(StepLimiterTest, calc_physics_step_limit)
         EXPECT_SOFT_EQ(0.001, to_cm(step.step));
     }
 }
+
+//---------------------------------------------------------------------------//
+
+class XsMajorantTest : public PhysicsStepUtilsTest
+{
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.xs_majorant_bins_per_decade = 4;
+        return opts;
+    }
+};
+
+TEST_F(XsMajorantTest, calc_physics_step_limit)
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), TrackSlotId{0});
+    PhysicsStepView pstep = this->step_view();
+
+    std::vector<real_type> majorant_ratio;
+    for (char const* particle_name : {"gamma", "celeriton", "electron"})
+    {
+        for (real_type energy : {1e-3, 0.01, 0.3, 10.0})
+        {
+            MaterialView mat_view(this->material()->host_ref(), MaterialId{1});
+            PhysicsTrackView phys = this->init_track(&material,
+                                                     MaterialId{1},
+                                                     &particle,
+                                                     particle_name,
+                                                     MevEnergy{energy});
+            phys.interaction_mfp(1);
+            calc_physics_step_limit(material, particle, phys, pstep);
+            EXPECT_EQ(energy, pstep.majorant_energy().value());
+
+            // Majorant must bound the directly calculated total
+            real_type total_xs = calc_per_process_xs(mat_view,
+                                                     particle.energy(),
+                                                     particle.log_energy(),
+                                                     phys,
+                                                     pstep);
+            EXPECT_LE(total_xs, pstep.macro_xs());
+            majorant_ratio.push_back(pstep.macro_xs() / total_xs);
+        }
+    }
+    real_type const expected_majorant_ratio[] = {1.001,
+                                                 1.001,
+                                                 1.001,
+                                                 1.001,
+                                                 1.001,
+                                                 1.001,
+                                                 1.001,
+                                                 1.001,
+                                                 1.0088692695904,
+                                                 1.0731349712453,
+                                                 1.006228673404,
+                                                 1.295518543519};
+    EXPECT_VEC_SOFT_EQ(expected_majorant_ratio, majorant_ratio);
+
+    {
+        // Stopped particles calculate per-process cross sections directly
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{1}, &particle, "celeriton", zero_quantity());
+        phys.interaction_mfp(1);
+        StepLimit step
+            = calc_physics_step_limit(material, particle, phys, pstep);
+        EXPECT_EQ(0, step.step);
+        EXPECT_EQ(0, pstep.majorant_energy().value());
+    }
+    {
+        // Energies above the tabulated range are also calculated directly
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{1}, &particle, "celeriton", MevEnergy{1e4});
+        phys.interaction_mfp(1);
+        calc_physics_step_limit(material, particle, phys, pstep);
+        EXPECT_EQ(0, pstep.majorant_energy().value());
+    }
+}
+
+TEST_F(XsMajorantTest, TEST_IF_CELERITAS_DOUBLE(select_discrete_interaction))
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), TrackSlotId{0});
+    PhysicsStepView pstep = this->step_view();
+
+    auto const model_offset
+        = this->physics()->host_ref().scalars.model_to_action;
+    auto reject_action
+        = this->physics()->host_ref().scalars.integral_rejection_action();
+
+    MaterialView mat_view(this->material()->host_ref(), MaterialId{1});
+    PhysicsTrackView phys = this->init_track(
+        &material, MaterialId{1}, &particle, "celeriton", MevEnergy{10});
+    phys.interaction_mfp(1);
+    calc_physics_step_limit(material, particle, phys, pstep);
+    real_type majorant_xs = pstep.macro_xs();
+
+    // Interact after losing energy
+    particle.energy(MevEnergy{9});
+
+    unsigned int num_samples = 10000;
+    std::vector<unsigned int> counts(10, 0);
+    unsigned int num_rejected = 0;
+    for (unsigned int j = 0; j < num_samples; ++j)
+    {
+        phys.reset_interaction_mfp();
+        auto action = select_discrete_interaction(
+            mat_view, particle, phys, pstep, this->rng());
+        if (action == reject_action)
+        {
+            ++num_rejected;
+            continue;
+        }
+        auto model = action.unchecked_get() - model_offset;
+        ASSERT_LT(model, counts.size());
+        ++counts[model];
+    }
+    // The majorant is unchanged by the deferred calculation
+    EXPECT_EQ(majorant_xs, pstep.macro_xs());
+
+    static unsigned int const expected_counts[]
+        = {0u, 1122u, 0u, 0u, 3393u, 0u, 0u, 0u, 5472u, 0u};
+    EXPECT_VEC_EQ(expected_counts, counts);
+    EXPECT_EQ(13, num_rejected);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
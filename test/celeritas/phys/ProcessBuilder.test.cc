@@ -418,7 +418,12 @@ TEST_F(ProcessBuilderTest, bremsstrahlung_combined_model)
         for (auto const& model : models)
         {
             auto builders = model->micro_xs(applic);
-            EXPECT_TRUE(builders.empty());
+            auto material = this->material()->get(mat_id);
+            EXPECT_EQ(material.num_elements(), builders.size());
+            for (auto elcomp_idx : range(material.num_elements()))
+            {
+                EXPECT_TRUE(builders[elcomp_idx]);
+            }
         }
     }
 }
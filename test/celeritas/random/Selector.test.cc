@@ -8,6 +8,7 @@
 #include "celeritas/random/Selector.hh"
 
 #include "corecel/OpaqueId.hh"
+#include "celeritas/random/AliasTable.hh"
 
 #include "SequenceEngine.hh"
 #include "celeritas_test.hh"
@@ -134,6 +135,104 @@ TEST(SelectorTest, selector_element)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+class AliasSelectorTest : public Test
+{
+  public:
+    using VecDbl = std::vector<double>;
+    using VecEntry = std::vector<AliasTableEntry>;
+
+    //! Probability of each index implied by the table
+    static VecDbl calc_pdf(VecEntry const& table)
+    {
+        VecDbl result(table.size(), 0.0);
+        double const norm = 1.0 / table.size();
+        for (auto i : range(table.size()))
+        {
+            result[i] += table[i].threshold * norm;
+            result[table[i].alias] += (1 - table[i].threshold) * norm;
+        }
+        return result;
+    }
+
+    //! Fraction of a uniform grid of random numbers selecting each index
+    static VecDbl tally(VecEntry const& table)
+    {
+        constexpr int num_samples = 1000;
+        AliasSelector<size_type> sample{make_span(table)};
+        VecDbl result(table.size(), 0.0);
+        for (auto i : range(num_samples))
+        {
+            auto rng = make_rng((i + 0.5) / num_samples);
+            size_type idx = sample(rng);
+            EXPECT_LT(idx, table.size());
+            result[idx] += 1.0 / num_samples;
+        }
+        return result;
+    }
+};
+
+TEST_F(AliasSelectorTest, typical)
+{
+    static double const prob[] = {0.1, 0.3, 0.5, 0.1};
+    auto table = make_alias_table(make_span(prob));
+    ASSERT_EQ(4, table.size());
+    EXPECT_VEC_SOFT_EQ(prob, calc_pdf(table));
+    EXPECT_VEC_NEAR(prob, tally(table), 0.01);
+
+    AliasSelector<size_type> sample_prob{make_span(table)};
+    auto rng = make_rng(0.0);
+    EXPECT_TRUE(
+        (std::is_same<decltype(sample_prob(rng)), size_type>::value));
+
+    // Check that highest representable value doesn't go off the end
+    rng = SequenceEngine{{0xffffffffu, 0xffffffffu}};
+    EXPECT_LT(sample_prob(rng), 4);
+}
+
+TEST_F(AliasSelectorTest, unnormalized)
+{
+    static double const weights[] = {0.0, 3.0, 0.0, 1.0, 4.0};
+    static double const expected_pdf[] = {0.0, 0.375, 0.0, 0.125, 0.5};
+    auto table = make_alias_table(make_span(weights));
+    EXPECT_VEC_SOFT_EQ(expected_pdf, calc_pdf(table));
+    EXPECT_VEC_NEAR(expected_pdf, tally(table), 0.01);
+}
+
+TEST_F(AliasSelectorTest, single)
+{
+    static double const weights[] = {0.25};
+    auto table = make_alias_table(make_span(weights));
+    ASSERT_EQ(1, table.size());
+    EXPECT_EQ(1, table[0].threshold);
+
+    AliasSelector<size_type> sample{make_span(table)};
+    auto rng = make_rng(0.999);
+    EXPECT_EQ(0, sample(rng));
+}
+
+TEST_F(AliasSelectorTest, opaque_id)
+{
+    using TransitionId = OpaqueId<struct Transition_>;
+    static double const weights[] = {1.0, 2.0, 4.0};
+    auto table = make_alias_table(make_span(weights));
+
+    AliasSelector<TransitionId> sample{make_span(table)};
+    auto rng = make_rng(0.0);
+    EXPECT_TRUE((std::is_same<decltype(sample(rng)), TransitionId>::value));
+    rng = make_rng(0.5);
+    EXPECT_LT(sample(rng), TransitionId{3});
+}
+
+TEST_F(AliasSelectorTest, invalid)
+{
+    static double const zeros[] = {0.0, 0.0};
+    EXPECT_THROW(make_alias_table(make_span(zeros)), RuntimeError);
+    static double const negative[] = {1.0, -0.5};
+    EXPECT_THROW(make_alias_table(make_span(negative)), RuntimeError);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
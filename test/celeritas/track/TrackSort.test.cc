@@ -20,6 +20,7 @@
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/global/Stepper.hh"
+#include "celeritas/global/detail/CoreStateThreadOffsets.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
@@ -159,6 +160,21 @@ class TestTrackSortActionIdEm3Stepper : public TestEm3NoMsc
     }
 };
 
+#define TestTrackSortMaterialEm3Stepper \
+    TEST_IF_CELERITAS_GEANT(TestTrackSortMaterialEm3Stepper)
+class TestTrackSortMaterialEm3Stepper : public TestEm3NoMsc
+{
+  protected:
+    auto build_init() -> SPConstTrackInit override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::sort_material;
+        return std::make_shared<TrackInitParams>(input);
+    }
+};
+
 #define TestActionCountEm3Stepper \
     TEST_IF_CELERITAS_GEANT(TestActionCountEm3Stepper)
 template<MemSpace M>
@@ -433,6 +449,37 @@ TEST_F(TestTrackSortActionIdEm3Stepper, TEST_IF_CELER_DEVICE(device_is_sorted))
     }
 }
 
+TEST_F(TestTrackSortMaterialEm3Stepper, host_is_sorted)
+{
+    auto step = this->make_stepper<MemSpace::host>(128);
+    auto primaries = this->make_primaries(8);
+    step(make_span(primaries));
+
+    auto check_is_sorted = [&step] {
+        auto const& mat_state = step.state_ref().materials.state;
+        auto const& track_slots = step.state_ref().track_slots;
+        for (celeritas::size_type i = 0; i < track_slots.size() - 1; ++i)
+        {
+            MaterialId mat_current
+                = mat_state[TrackSlotId{track_slots[ThreadId{i}]}].material_id;
+            MaterialId mat_next
+                = mat_state[TrackSlotId{track_slots[ThreadId{i + 1}]}]
+                      .material_id;
+            // Null materials (inactive tracks) are sorted last
+            ASSERT_TRUE(!mat_next
+                        || (mat_current && mat_current <= mat_next))
+                << "material " << mat_current.unchecked_get()
+                << " is sorted before " << mat_next.unchecked_get();
+        }
+    };
+    for (auto i = 0; i < 10; ++i)
+    {
+        detail::sort_tracks(step.state_ref(), TrackOrder::sort_material);
+        check_is_sorted();
+        step();
+    }
+}
+
 using TestActionCountEm3StepperH = TestActionCountEm3Stepper<MemSpace::host>;
 TEST_F(TestActionCountEm3StepperH, host_count_actions)
 {
@@ -474,6 +521,42 @@ TEST_F(TestActionCountEm3StepperH, host_count_actions)
     }
 }
 
+TEST_F(TestActionCountEm3StepperH, host_sort_and_count_actions)
+{
+    auto step = this->make_stepper<MemSpace::host>(128);
+    auto primaries = this->make_primaries(8);
+    step(make_span(primaries));
+
+    auto num_actions = this->action_reg()->num_actions();
+    HostActionThreads sorted_offsets;
+    HostActionThreads counted_offsets;
+    resize(&sorted_offsets, num_actions + 1);
+    resize(&counted_offsets, num_actions + 1);
+
+    // Reuse the sort buffers between steps as the state does
+    detail::TrackSortBuffers buffers;
+    for (auto i = 0; i < 10; ++i)
+    {
+        // Offsets from the counting sort should match a separate count
+        detail::sort_tracks(step.state_ref(),
+                            TrackOrder::sort_step_limit_action,
+                            sorted_offsets[AllActionThreads{}],
+                            &buffers);
+        check_action_count(sorted_offsets, step.state().size());
+
+        detail::count_tracks_per_action(step.state_ref(),
+                                        counted_offsets[AllActionThreads{}],
+                                        counted_offsets,
+                                        TrackOrder::sort_step_limit_action);
+        for (auto a : range(ActionId{num_actions + 1}))
+        {
+            EXPECT_EQ(counted_offsets[a], sorted_offsets[a])
+                << "action " << a.unchecked_get();
+        }
+        step();
+    }
+}
+
 using TestActionCountEm3StepperD = TestActionCountEm3Stepper<MemSpace::device>;
 TEST_F(TestActionCountEm3StepperD, TEST_IF_CELER_DEVICE(device_count_actions))
 {
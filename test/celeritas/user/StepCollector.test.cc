@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/user/StepCollector.hh"
 
+#include <fstream>
+
 #include "corecel/cont/Span.hh"
 #include "corecel/io/LogContextException.hh"
 #include "corecel/sys/ActionRegistry.hh"
@@ -19,6 +21,7 @@
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
 #include "celeritas/user/SimpleCalo.hh"
+#include "celeritas/user/StepColumnWriter.hh"
 
 #include "CaloTestBase.hh"
 #include "ExampleMctruth.hh"
@@ -177,6 +180,82 @@ TEST_F(KnStepCollectorTestBase, multiple_interfaces)
     EXPECT_EQ(4, mctruth->steps().size());
 }
 
+TEST_F(KnStepCollectorTestBase, column_writer)
+{
+    std::string filename = this->make_unique_filename(".bin");
+    {
+        StepSelection selection;
+        selection.event_id = true;
+        selection.points[StepPoint::post].pos = true;
+        auto writer = std::make_shared<StepColumnWriter>(
+            filename, selection, /* max_queued = */ 1);
+        auto collector = std::make_shared<StepCollector>(
+            StepCollector::VecInterface{writer},
+            this->geometry(),
+            /* num_streams = */ 1,
+            this->action_reg().get());
+
+        StepperInput step_inp;
+        step_inp.params = this->core();
+        step_inp.stream_id = StreamId{0};
+        step_inp.num_track_slots = 4;
+
+        Stepper<MemSpace::host> step(step_inp);
+
+        auto primaries = this->make_primaries(3);
+        CELER_TRY_HANDLE(step(make_span(primaries)),
+                         LogContextException{this->output_reg().get()});
+        CELER_TRY_HANDLE(step(), LogContextException{this->output_reg().get()});
+        writer->flush();
+    }
+
+    std::ifstream infile(filename, std::ios::binary);
+    ASSERT_TRUE(read_step_column_header(infile));
+
+    std::vector<size_type> num_rows;
+    std::vector<std::string> names;
+    std::vector<size_type> event_ids;
+    std::vector<real_type> pos;
+    StepColumnChunk chunk;
+    while (read_step_column_chunk(infile, &chunk))
+    {
+        num_rows.push_back(chunk.num_rows);
+        names.clear();
+        for (StepColumn const& col : chunk.columns)
+        {
+            names.push_back(col.name);
+            if (col.name == "event_id")
+            {
+                ASSERT_EQ('u', col.type);
+                ASSERT_EQ(sizeof(size_type), col.type_size);
+                auto const* data
+                    = reinterpret_cast<size_type const*>(col.data.data());
+                event_ids.insert(event_ids.end(), data, data + chunk.num_rows);
+            }
+            else if (col.name == "post_pos")
+            {
+                ASSERT_EQ('f', col.type);
+                ASSERT_EQ(3, col.width);
+                auto const* data
+                    = reinterpret_cast<real_type const*>(col.data.data());
+                pos.insert(pos.end(), data, data + 3 * chunk.num_rows);
+            }
+        }
+    }
+
+    // A secondary is produced in the first step
+    static size_type const expected_num_rows[] = {3, 4};
+    EXPECT_VEC_EQ(expected_num_rows, num_rows);
+    static char const* const expected_names[]
+        = {"track_id", "event_id", "post_pos"};
+    EXPECT_VEC_EQ(expected_names, names);
+    static size_type const expected_event_ids[] = {0, 1, 2, 0, 0, 1, 2};
+    EXPECT_VEC_EQ(expected_event_ids, event_ids);
+    ASSERT_EQ(21, pos.size());
+    EXPECT_GT(pos[0], 0);
+    EXPECT_SOFT_EQ(0, pos[1]);
+}
+
 //---------------------------------------------------------------------------//
 // KLEIN-NISHINA
 //---------------------------------------------------------------------------//
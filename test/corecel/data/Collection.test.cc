@@ -17,6 +17,7 @@
 #include "corecel/data/CollectionMirror.hh"
 #include "corecel/data/DedupeCollectionBuilder.hh"
 #include "corecel/data/DeviceVector.hh"
+#include "corecel/data/HugePageAllocator.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/sys/Device.hh"
 
@@ -345,6 +346,73 @@ TEST_F(SimpleCollectionTest, algo_host)
     }
 }
 
+TEST_F(SimpleCollectionTest, huge_pages)
+{
+    constexpr auto huge_page_size = HugePageAllocator<int>::huge_page_size;
+
+    // Huge pages are opt-in
+    bool const orig_enabled = huge_pages_enabled();
+    enable_huge_pages(true);
+
+    // Small collections use regular allocation
+    Value<host> small;
+    resize(&small, 4);
+    EXPECT_EQ(4, small.size());
+
+    // Large collections start on a huge page boundary
+    Value<host> large;
+    resize(&large, huge_page_size / sizeof(int) + 1);
+    auto data = large[AllInts<host>{}];
+    EXPECT_EQ(0,
+              reinterpret_cast<std::uintptr_t>(data.data()) % huge_page_size);
+    data.back() = 123;
+
+    // Copies use the same allocator
+    Value<host> copied(large);
+    EXPECT_EQ(123, copied[AllInts<host>{}].back());
+    EXPECT_EQ(0,
+              reinterpret_cast<std::uintptr_t>(
+                  copied[AllInts<host>{}].data())
+                  % huge_page_size);
+
+    // Existing collections keep their policy after the setting changes
+    enable_huge_pages(false);
+    Value<host> moved;
+    moved = std::move(copied);
+    EXPECT_EQ(123, moved[AllInts<host>{}].back());
+    enable_huge_pages(orig_enabled);
+}
+
+TEST_F(SimpleCollectionTest, over_aligned)
+{
+    struct alignas(64) Aligned
+    {
+        double value;
+    };
+    static_assert(alignof(Aligned) > __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+    for (bool huge : {false, true})
+    {
+        SCOPED_TRACE(huge ? "huge" : "standard");
+        bool const orig_enabled = huge_pages_enabled();
+        enable_huge_pages(huge);
+        std::vector<Collection<Aligned, Ownership::value, MemSpace::host>>
+            all_values;
+        for (size_type size : {1, 3, 17, 1000})
+        {
+            all_values.emplace_back();
+            auto& values = all_values.back();
+            resize(&values, size);
+            auto data = values[AllItems<Aligned>{}];
+            EXPECT_EQ(0,
+                      reinterpret_cast<std::uintptr_t>(data.data())
+                          % alignof(Aligned));
+            data.back().value = 2.0;
+        }
+        enable_huge_pages(orig_enabled);
+    }
+}
+
 TEST_F(SimpleCollectionTest, TEST_IF_CELER_DEVICE(algo_device))
 {
     Value<device> src;
@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/DataCache.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/data/DataCache.hh"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "corecel/OpaqueId.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+struct MockRecord
+{
+    int a;
+    real_type b;
+};
+
+template<class T>
+using HostItems = Collection<T, Ownership::value, MemSpace::host>;
+
+class DataCacheTest : public ::celeritas::test::Test
+{
+  protected:
+    void SetUp() override
+    {
+        make_builder(&reals).insert_back({1.0, 2.5, -3.0});
+        make_builder(&records).insert_back({{1, 0.5}, {2, 1.5}});
+        filename = this->make_unique_filename(".bin");
+
+        DataCacheWriter write_cache(filename, 1234);
+        write_cache(reals);
+        write_cache(records);
+        write_cache(size_type{17});
+        write_cache.finalize();
+    }
+
+    HostItems<real_type> reals;
+    HostItems<MockRecord> records;
+    std::string filename;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(DataCacheTest, round_trip)
+{
+    HostItems<real_type> new_reals;
+    HostItems<MockRecord> new_records;
+    size_type value{0};
+
+    DataCacheReader read_cache(filename, 1234);
+    EXPECT_TRUE(read_cache);
+    read_cache(&new_reals);
+    read_cache(&new_records);
+    read_cache(&value);
+    EXPECT_TRUE(read_cache.finalize());
+
+    auto all_reals = AllItems<real_type, MemSpace::host>{};
+    std::vector<real_type> actual_reals(new_reals[all_reals].begin(),
+                                        new_reals[all_reals].end());
+    static real_type const expected_reals[] = {1.0, 2.5, -3.0};
+    EXPECT_VEC_EQ(expected_reals, actual_reals);
+
+    ASSERT_EQ(2, new_records.size());
+    EXPECT_EQ(2, new_records[ItemId<MockRecord>{1}].a);
+    EXPECT_EQ(1.5, new_records[ItemId<MockRecord>{1}].b);
+    EXPECT_EQ(17, value);
+}
+
+TEST_F(DataCacheTest, incompatible)
+{
+    {
+        // Missing file
+        DataCacheReader read_cache(filename + ".missing", 1234);
+        EXPECT_FALSE(read_cache);
+        EXPECT_FALSE(read_cache.finalize());
+    }
+    {
+        // Different inputs
+        DataCacheReader read_cache(filename, 4321);
+        EXPECT_FALSE(read_cache);
+    }
+    {
+        // Mismatched types
+        HostItems<MockRecord> new_records;
+        DataCacheReader read_cache(filename, 1234);
+        read_cache(&new_records);
+        EXPECT_FALSE(read_cache);
+        EXPECT_EQ(0, new_records.size());
+    }
+    {
+        // Missing data
+        HostItems<real_type> new_reals;
+        DataCacheReader read_cache(filename, 1234);
+        read_cache(&new_reals);
+        EXPECT_TRUE(read_cache);
+        EXPECT_FALSE(read_cache.finalize());
+    }
+}
+
+TEST_F(DataCacheTest, truncated)
+{
+    // Copy all but the last few bytes
+    std::string truncated = this->make_unique_filename("-trunc.bin");
+    {
+        std::ifstream in(filename, std::ios::binary);
+        std::string contents{std::istreambuf_iterator<char>(in),
+                             std::istreambuf_iterator<char>()};
+        contents.resize(contents.size() - 3);
+        std::ofstream out(truncated, std::ios::binary);
+        out << contents;
+    }
+
+    HostItems<real_type> new_reals;
+    HostItems<MockRecord> new_records;
+    size_type value{0};
+    DataCacheReader read_cache(truncated, 1234);
+    read_cache(&new_reals);
+    read_cache(&new_records);
+    read_cache(&value);
+    EXPECT_FALSE(read_cache);
+    EXPECT_FALSE(read_cache.finalize());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,171 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/ScopedSharedParams.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/data/ScopedSharedParams.hh"
+
+#include <cstdint>
+#include <thread>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/sys/MpiOperations.hh"
+
+#include "Collection.test.hh"
+#include "celeritas_test.hh"
+
+#if CELERITAS_USE_MPI
+#    define TEST_IF_CELERITAS_MPI(name) name
+#else
+#    define TEST_IF_CELERITAS_MPI(name) DISABLED_##name
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class ScopedSharedParamsTest : public Test
+{
+  protected:
+    using MirrorT = CollectionMirror<MockParamsData>;
+
+    //! Build data large enough to be shared
+    static HostVal<MockParamsData> build_data()
+    {
+        HostVal<MockParamsData> data;
+        constexpr size_type num_elements
+            = ScopedSharedParams::min_bytes / sizeof(MockElement) + 1;
+        auto elements = make_builder(&data.elements);
+        elements.reserve(num_elements);
+        for (auto i : range(num_elements))
+        {
+            elements.push_back({static_cast<int>(i % 100), 2.0 * i});
+        }
+        make_builder(&data.materials)
+            .push_back({1.5, ItemRange<MockElement>{MockElementId{1},
+                                                     MockElementId{4}}});
+        data.max_element_components = 3;
+        return data;
+    }
+
+    //! Build params from existing data
+    static MirrorT build_params() { return MirrorT{build_data()}; }
+
+    static void check_params(MirrorT const& params)
+    {
+        auto const& ref = params.host_ref();
+        ASSERT_TRUE(ref);
+        EXPECT_EQ(3, ref.max_element_components);
+        EXPECT_EQ(1, ref.materials.size());
+        auto const& mat = ref.materials[MockMaterialId{0}];
+        EXPECT_DOUBLE_EQ(1.5, mat.number_density);
+        auto els = ref.elements[mat.elements];
+        ASSERT_EQ(3, els.size());
+        EXPECT_EQ(1, els[0].atomic_number);
+        EXPECT_DOUBLE_EQ(6.0, els[2].atomic_mass);
+        auto const& last = ref.elements[MockElementId{ref.elements.size() - 1}];
+        EXPECT_EQ(static_cast<int>((ref.elements.size() - 1) % 100),
+                  last.atomic_number);
+    }
+};
+
+TEST_F(ScopedSharedParamsTest, inactive)
+{
+    EXPECT_EQ(nullptr, ScopedSharedParams::node_comm());
+    {
+        ScopedSharedParams share_params{MpiCommunicator{}};
+        EXPECT_EQ(nullptr, ScopedSharedParams::node_comm());
+
+        auto params = build_params();
+        this->check_params(params);
+
+        int num_builds = 0;
+        MirrorT built{[&num_builds] {
+            ++num_builds;
+            return build_data();
+        }};
+        this->check_params(built);
+        EXPECT_EQ(1, num_builds);
+    }
+    EXPECT_EQ(nullptr, ScopedSharedParams::node_comm());
+}
+
+TEST_F(ScopedSharedParamsTest, TEST_IF_CELERITAS_MPI(world))
+{
+    auto comm = MpiCommunicator::comm_world();
+    std::uintptr_t addr{};
+    {
+        ScopedSharedParams share_params{comm};
+        auto const* node_comm = ScopedSharedParams::node_comm();
+        EXPECT_EQ(comm.size() > 1, node_comm != nullptr);
+
+        auto params = build_params();
+        this->check_params(params);
+        addr = reinterpret_cast<std::uintptr_t>(
+            params.host_ref().elements.data().get());
+    }
+
+    // Shared data is at the same address in all processes
+    auto min_addr = allreduce<unsigned long long>(comm, Operation::min, addr);
+    auto max_addr = allreduce<unsigned long long>(comm, Operation::max, addr);
+    if (comm.size() > 1)
+    {
+        EXPECT_EQ(min_addr, max_addr);
+    }
+}
+
+TEST_F(ScopedSharedParamsTest, TEST_IF_CELERITAS_MPI(build_once))
+{
+    auto comm = MpiCommunicator::comm_world();
+    int num_builds = 0;
+    int num_nodes = 0;
+    {
+        ScopedSharedParams share_params{comm};
+        MirrorT params{[&num_builds] {
+            ++num_builds;
+            return build_data();
+        }};
+        this->check_params(params);
+
+        auto const* node_comm = ScopedSharedParams::node_comm();
+        num_nodes = (!node_comm || node_comm->rank() == 0) ? 1 : 0;
+    }
+
+    // Only the first process on each node builds the data
+    EXPECT_EQ(allreduce(comm, Operation::sum, num_nodes),
+              allreduce(comm, Operation::sum, num_builds));
+}
+
+TEST_F(ScopedSharedParamsTest, TEST_IF_CELERITAS_MPI(build_failure))
+{
+    ScopedSharedParams share_params{MpiCommunicator::comm_world()};
+
+    // Every process throws rather than waiting for the shared data
+    EXPECT_THROW(MirrorT([]() -> HostVal<MockParamsData> {
+                     CELER_VALIDATE(false, << "invalid params input");
+                     return {};
+                 }),
+                 RuntimeError);
+}
+
+TEST_F(ScopedSharedParamsTest, TEST_IF_CELERITAS_MPI(thread_local))
+{
+    ScopedSharedParams share_params{MpiCommunicator::comm_world()};
+
+    // Sharing is only active on the constructing thread
+    bool other_active{true};
+    std::thread([&other_active] {
+        other_active = (ScopedSharedParams::node_comm() != nullptr);
+    }).join();
+    EXPECT_FALSE(other_active);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/WorkQueue.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/WorkQueue.hh"
+
+#include <atomic>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(WorkQueueTest, ordered)
+{
+    std::vector<int> consumed;
+    WorkQueue<int> queue(2, [&consumed](int& i) { consumed.push_back(i); });
+    EXPECT_EQ(2, queue.capacity());
+
+    for (auto i : range(10))
+    {
+        queue.push(i);
+    }
+    queue.wait();
+    std::vector<int> const expected{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(expected, consumed);
+
+    // Waiting again is a no-op
+    queue.wait();
+    EXPECT_EQ(10, consumed.size());
+}
+
+TEST(WorkQueueTest, backpressure)
+{
+    std::mutex gate;
+    std::atomic<int> num_consumed{0};
+    WorkQueue<int> queue(1, [&](int&) {
+        std::lock_guard scoped_lock{gate};
+        ++num_consumed;
+    });
+
+    {
+        // Block the consumer: one item is in progress and one is waiting
+        std::unique_lock lock{gate};
+        queue.push(0);
+        queue.push(1);
+        std::thread producer([&queue] { queue.push(2); });
+        // The third push can't complete until the consumer makes room
+        EXPECT_EQ(0, num_consumed.load());
+        lock.unlock();
+        producer.join();
+    }
+    queue.wait();
+    EXPECT_EQ(3, num_consumed.load());
+}
+
+TEST(WorkQueueTest, error)
+{
+    std::vector<int> consumed;
+    WorkQueue<int> queue(4, [&consumed](int& i) {
+        CELER_VALIDATE(i != 1, << "bad item");
+        consumed.push_back(i);
+    });
+
+    queue.push(0);
+    queue.push(1);
+    EXPECT_THROW(queue.wait(), RuntimeError);
+
+    // The queue is usable after the error is seen
+    queue.push(2);
+    queue.wait();
+    std::vector<int> const expected{0, 2};
+    EXPECT_EQ(expected, consumed);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
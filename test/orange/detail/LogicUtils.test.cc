@@ -0,0 +1,116 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/LogicUtils.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/LogicUtils.hh"
+
+#include <sstream>
+
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+constexpr auto ltrue = logic::ltrue;
+constexpr auto lor = logic::lor;
+constexpr auto land = logic::land;
+constexpr auto lnot = logic::lnot;
+
+std::string to_string(std::vector<logic_int> const& logic)
+{
+    std::ostringstream os;
+    for (auto i : range(logic.size()))
+    {
+        if (i > 0)
+        {
+            os << ' ';
+        }
+        if (logic::is_operator_token(logic[i]))
+        {
+            os << to_char(static_cast<logic::OperatorToken>(logic[i]));
+        }
+        else
+        {
+            os << logic[i];
+        }
+    }
+    return os.str();
+}
+
+std::string sorted(std::vector<logic_int> const& logic,
+                   std::vector<size_type> const& cost)
+{
+    return to_string(sort_logic_operands(make_span(logic), make_span(cost)));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(LogicUtilsTest, sort_logic_operands)
+{
+    // Single surface and background volume are unchanged
+    EXPECT_EQ("0 ~", sorted({0, lnot}, {1}));
+    EXPECT_EQ("* ~", sorted({ltrue, lnot}, {}));
+
+    // Intersection: cheapest first, ties keep their order
+    EXPECT_EQ("2 ~ 0 & 1 ~ &",
+              sorted({0, 1, lnot, land, 2, lnot, land}, {3, 3, 1}));
+
+    // Right-nested intersection is flattened into a chain
+    EXPECT_EQ("2 1 & 0 &", sorted({0, 1, 2, land, land}, {5, 3, 1}));
+
+    // Union of intersections: sub-expressions sort by total cost
+    EXPECT_EQ("2 3 & 0 1 & |",
+              sorted({0, 1, land, 2, 3, land, lor}, {4, 4, 1, 1}));
+
+    // Negated sub-expressions are not flattened into the parent
+    EXPECT_EQ("0 1 & ~ 2 &",
+              sorted({2, 0, 1, land, lnot, land}, {1, 1, 5}));
+
+    // Reordering never deepens the stack: the deepest operand stays first
+    EXPECT_EQ("0 1 & 2 |", sorted({0, 1, land, 2, lor}, {5, 5, 1}));
+    EXPECT_EQ("0 1 & ~ 2 &",
+              sorted({0, 1, land, lnot, 2, land}, {1, 1, 1}));
+    EXPECT_EQ("0 1 & 2 | 4 & 3 &",
+              sorted({0, 1, land, 2, lor, 3, land, 4, land},
+                     {5, 5, 1, 2, 1}));
+
+    // Malformed expressions are returned unchanged
+    EXPECT_EQ("0 & 1", sorted({0, land, 1}, {1, 1}));
+}
+
+TEST(LogicUtilsTest, calc_operand_ends)
+{
+    auto calc_ends = [](std::vector<logic_int> const& logic) {
+        return calc_operand_ends(make_span(logic));
+    };
+
+    // No binary operators
+    EXPECT_VEC_EQ((std::vector<logic_int>{2, 2}), calc_ends({ltrue, lnot}));
+
+    // Chain: each later operand is combined by the following operator
+    EXPECT_VEC_EQ((std::vector<logic_int>{5, 2, 5, 4, 5}),
+                  calc_ends({0, 1, land, 2, land}));
+
+    // Nested: "1 2 &" is the second operand of the outer operator
+    EXPECT_VEC_EQ((std::vector<logic_int>{5, 4, 3, 5, 5}),
+                  calc_ends({0, 1, 2, land, land}));
+
+    // Negation is part of its operand
+    EXPECT_VEC_EQ((std::vector<logic_int>{4, 3, 4, 4}),
+                  calc_ends({0, 1, lnot, lor}));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
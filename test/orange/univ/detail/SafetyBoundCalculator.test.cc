@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/SafetyBoundCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/univ/detail/SafetyBoundCalculator.hh"
+
+#include <cmath>
+
+#include "orange/surf/PlaneAligned.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(SafetyBoundCalculatorTest, cylinder)
+{
+    CylZ cyl{{1, 0, 0}, 2.0};
+    Real3 pos{4, 0, 10};
+    SafetyBoundCalculator calc_bound{pos};
+    EXPECT_SOFT_EQ(1.0, calc_bound(cyl));
+
+    pos = {1, 1.5, -3};
+    EXPECT_SOFT_EQ(0.5, calc_bound(cyl));
+}
+
+TEST(SafetyBoundCalculatorTest, quadric)
+{
+    // Sphere of radius 2 about the origin
+    SimpleQuadric sq{{1, 1, 1}, {0, 0, 0}, -4};
+    GeneralQuadric gq{{1, 1, 1}, {0, 0, 0}, {0, 0, 0}, -4};
+
+    Real3 pos{3, 0, 0};
+    SafetyBoundCalculator calc_bound{pos};
+    EXPECT_SOFT_EQ(10 / (6 + std::sqrt(real_type{56})), calc_bound(sq));
+    EXPECT_LE(calc_bound(sq), 1.0);
+    // General quadric uses the (looser) Frobenius norm
+    EXPECT_SOFT_EQ(10 / (6 + std::sqrt(36 + 20 * std::sqrt(real_type{3}))),
+                   calc_bound(gq));
+
+    // Inside
+    pos = {0, 0.5, 0};
+    EXPECT_LE(calc_bound(sq), 1.5);
+    EXPECT_GT(calc_bound(sq), 0);
+    EXPECT_GT(calc_bound(gq), 0);
+    EXPECT_LE(calc_bound(gq), calc_bound(sq));
+
+    // On the surface
+    pos = {0, 0, 2};
+    EXPECT_SOFT_EQ(0, calc_bound(sq));
+}
+
+TEST(SafetyBoundCalculatorTest, rotated_quadric)
+{
+    // Cylinder of radius 1 along the (1, 1, 0) axis:
+    // x^2 + y^2 + 2 z^2 - 2 x y - 2 = 0
+    GeneralQuadric gq{{1, 1, 2}, {-2, 0, 0}, {0, 0, 0}, -2};
+
+    Real3 pos{1, -1, 0};
+    SafetyBoundCalculator calc_bound{pos};
+    // True distance from the axis is sqrt(2), so the distance is sqrt(2) - 1
+    real_type bound = calc_bound(gq);
+    EXPECT_GT(bound, 0);
+    EXPECT_LE(bound, std::sqrt(real_type{2}) - 1);
+}
+
+TEST(SafetyBoundCalculatorTest, cone)
+{
+    ConeZ cone{{0, 0, 0}, 1.0};
+    Real3 pos{2, 0, 0};
+    SafetyBoundCalculator calc_bound{pos};
+    // True distance is sqrt(2)
+    EXPECT_SOFT_EQ(2 * (std::sqrt(real_type{2}) - 1), calc_bound(cone));
+
+    // Vanishing point
+    pos = {0, 0, 0};
+    EXPECT_SOFT_EQ(0, calc_bound(cone));
+}
+
+TEST(SafetyBoundCalculatorTest, involute)
+{
+    Involute invo{{1, 0}, 2.0, 0.2, Chirality::right, 1.0, 3.0};
+    Real3 pos{1, 1, 0};
+    SafetyBoundCalculator calc_bound{pos};
+    EXPECT_SOFT_EQ(2 * std::sqrt(real_type{2}) - 1, calc_bound(invo));
+
+    pos = {9, 0, 0};
+    EXPECT_SOFT_EQ(8 - 2 * std::sqrt(real_type{10}), calc_bound(invo));
+
+    pos = {5, 0, 0};
+    EXPECT_SOFT_EQ(0, calc_bound(invo));
+}
+
+TEST(SafetyBoundCalculatorTest, other)
+{
+    Real3 pos{2, 0, 0};
+    SafetyBoundCalculator calc_bound{pos};
+    EXPECT_SOFT_EQ(0, calc_bound(PlaneX{1.0}));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
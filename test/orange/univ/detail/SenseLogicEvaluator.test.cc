@@ -0,0 +1,152 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/SenseLogicEvaluator.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/univ/detail/SenseLogicEvaluator.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Repr.hh"
+#include "orange/OrangeGeoTestBase.hh"
+#include "orange/surf/LocalSurfaceVisitor.hh"
+#include "orange/univ/VolumeView.hh"
+#include "orange/univ/detail/LogicEvaluator.hh"
+#include "orange/univ/detail/SenseCalculator.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class SenseLogicEvaluatorTest : public ::celeritas::test::OrangeGeoTestBase
+{
+  protected:
+    VolumeView make_volume_view(LocalVolumeId v) const
+    {
+        CELER_EXPECT(v);
+        auto const& host_ref = this->host_params();
+        return VolumeView{host_ref, host_ref.simple_units[SimpleUnitId{0}], v};
+    }
+
+    LocalSurfaceVisitor make_surf_visitor() const
+    {
+        return LocalSurfaceVisitor(this->host_params(), SimpleUnitId{0});
+    }
+
+    //! Access the shared CPU storage space for senses
+    Span<Sense> sense_storage()
+    {
+        return this->host_state().temp_sense[AllItems<Sense>{}];
+    }
+
+    //! Evaluate with all senses calculated up front
+    bool calc_inside_eager(VolumeView const& vol, Real3 const& pos)
+    {
+        SenseCalculator calc_senses(
+            this->make_surf_visitor(), pos, this->sense_storage());
+        return LogicEvaluator(vol.logic())(calc_senses(vol).senses);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SenseLogicEvaluatorTest, two_volumes)
+{
+    {
+        TwoVolInput geo_inp;
+        geo_inp.radius = 1.5;
+        this->build_geometry(geo_inp);
+    }
+
+    VolumeView outer = this->make_volume_view(LocalVolumeId{0});
+    VolumeView inner = this->make_volume_view(LocalVolumeId{1});
+    {
+        SenseLogicEvaluator calc_inside(this->make_surf_visitor(),
+                                        Real3{0, 0.5, 0});
+        auto result = calc_inside(inner);
+        EXPECT_TRUE(result.inside);
+        EXPECT_FALSE(result.face);
+        EXPECT_FALSE(calc_inside(outer).inside);
+    }
+    {
+        // Point is on the boundary: should register as "on" the face
+        SenseLogicEvaluator calc_inside(this->make_surf_visitor(),
+                                        Real3{1.5, 0, 0});
+        auto result = calc_inside(inner);
+        EXPECT_FALSE(result.inside);
+        EXPECT_EQ(FaceId{0}, result.face.id());
+        EXPECT_EQ(Sense::outside, result.face.sense());
+
+        // Known face overrides the calculated sense
+        result = calc_inside(inner, OnFace{FaceId{0}, Sense::inside});
+        EXPECT_TRUE(result.inside);
+        EXPECT_EQ(FaceId{0}, result.face.id());
+        EXPECT_EQ(Sense::inside, result.face.sense());
+    }
+}
+
+TEST_F(SenseLogicEvaluatorTest, five_volumes)
+{
+    this->build_geometry("five-volumes.org.json");
+
+    // Lazy evaluation must agree with eager evaluation everywhere
+    size_type num_inside = 0;
+    for (auto v : range(LocalVolumeId{this->num_volumes()}))
+    {
+        VolumeView vol = this->make_volume_view(v);
+        if (vol.logic().size() <= 2)
+        {
+            // Skip background volume
+            continue;
+        }
+        for (real_type x = -1.9; x < 2; x += 0.2)
+        {
+            for (real_type y = -1.9; y < 2; y += 0.2)
+            {
+                Real3 pos{x, y, 0.1};
+                SenseLogicEvaluator calc_inside(this->make_surf_visitor(),
+                                                pos);
+                bool inside = calc_inside(vol).inside;
+                EXPECT_EQ(this->calc_inside_eager(vol, pos), inside)
+                    << "volume " << v.get() << " at " << repr(pos);
+                num_inside += inside;
+            }
+        }
+    }
+    EXPECT_GT(num_inside, 0);
+
+    {
+        // Point is between spheres, on square edge (surface 8, face 4)
+        VolumeView vol_b = this->make_volume_view(LocalVolumeId{2});
+        Real3 const pos{0.5, -0.25, 0};
+        SenseLogicEvaluator calc_inside(this->make_surf_visitor(), pos);
+        SenseCalculator calc_senses(
+            this->make_surf_visitor(), pos, this->sense_storage());
+        LogicEvaluator eval_logic(vol_b.logic());
+        for (Sense s : {Sense::inside, Sense::outside})
+        {
+            OnFace face{FaceId{4}, s};
+            auto result = calc_inside(vol_b, face);
+            EXPECT_EQ(eval_logic(calc_senses(vol_b, face).senses),
+                      result.inside);
+            EXPECT_EQ(FaceId{4}, result.face.id());
+            EXPECT_EQ(s, result.face.sense());
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas